@@ -0,0 +1,268 @@
+/**
+ * @file convergence_criteria.h
+ * @brief Header file containing the composable stopping tests of gradient_decent.
+ *
+ * The legacy stopping test adds the last change of the optimal value to the step length and compares the sum with a
+ * single absolute tolerance, which iterates too long on large-valued objectives and stops too early on tiny-valued
+ * ones. The convergence_criteria class instead combines any number of independent tests (projected-gradient norm,
+ * absolute and relative value change, step size, stall over a window of iterations and target value); the solve stops
+ * as soon as one of them fires and reports which one did.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_CONVERGENCE_CRITERIA_H
+#define CONCEPTUAL_CONVERGENCE_CRITERIA_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace gd {
+    /**
+     * @brief The reason a solve stopped.
+     */
+    enum class stop_reason : std::uint8_t {
+        none,               ///< The solve has not stopped (yet).
+        tolerance,          ///< The legacy test: value change plus step length below the tolerance.
+        max_eval,           ///< The maximum number of evaluations was reached with the last value change within the tolerance.
+        gradient_norm,      ///< The projected-gradient norm fell below its threshold.
+        absolute_change,    ///< The absolute change of the optimal value fell below its threshold.
+        relative_change,    ///< The relative change of the optimal value fell below its threshold.
+        step_size,          ///< The step length fell below its threshold.
+        stall,              ///< The improvement over the stall window fell below its threshold.
+        target_value,       ///< The optimal value reached the target.
+        iteration_callback, ///< The iteration callback stopped the solve.
+        result_cache        ///< The result was found in the result cache.
+    };
+
+    /**
+     * @brief Returns the name of a stop reason.
+     */
+    [[nodiscard]] constexpr const char* to_string (stop_reason IN_REASON) noexcept {
+        switch (IN_REASON) {
+            case stop_reason::none: return "none";
+            case stop_reason::tolerance: return "tolerance";
+            case stop_reason::max_eval: return "max_eval";
+            case stop_reason::gradient_norm: return "gradient_norm";
+            case stop_reason::absolute_change: return "absolute_change";
+            case stop_reason::relative_change: return "relative_change";
+            case stop_reason::step_size: return "step_size";
+            case stop_reason::stall: return "stall";
+            case stop_reason::target_value: return "target_value";
+            case stop_reason::iteration_callback: return "iteration_callback";
+            case stop_reason::result_cache: return "result_cache";
+        }
+        return "unknown";
+    }
+
+    /**
+     * @brief What one iteration of a solve did, as seen by the stopping tests.
+     *
+     * @tparam returnType The type of the objective function's return value.
+     */
+    template <class returnType>
+    struct iteration_summary {
+        returnType value {};            ///< The optimal value after the iteration.
+        returnType previous_value {};   ///< The optimal value before the iteration.
+        returnType step_length {};      ///< The Euclidean distance between the old and the new optimal point.
+        returnType gradient_norm {};    ///< The projected-gradient norm at the old optimal point.
+        bool accepted = false;          ///< True if the iteration accepted a step, i.e. moved the optimal point.
+    };
+
+    /**
+     * @brief Ring buffer of the most recent optimal values of a solve, used by the stall test.
+     *
+     * @tparam returnType The type of the objective function's return value.
+     */
+    template <class returnType>
+    struct convergence_history {
+        std::vector<returnType> values;     ///< The ring of the last values.
+        std::size_t count = 0;              ///< The number of values pushed since the last reset.
+
+        /**
+         * @brief Clears the history and sizes it for the given window; allocates only when the window grows.
+         *
+         * @param IN_WINDOW The largest number of iterations looked back at.
+         */
+        void reset (std::size_t IN_WINDOW) {
+            this->values.assign(IN_WINDOW + 1, returnType{});
+            this->count = 0;
+        }
+
+        /**
+         * @brief Records the optimal value after an iteration.
+         */
+        void push (returnType IN_VALUE) noexcept {
+            this->values[this->count % this->values.size()] = IN_VALUE;
+            ++this->count;
+        }
+
+        /**
+         * @brief Returns true if the value from the given number of iterations ago is recorded.
+         */
+        [[nodiscard]] bool has (std::size_t IN_AGO) const noexcept {
+            return IN_AGO < this->values.size() && IN_AGO < this->count;
+        }
+
+        /**
+         * @brief Returns the value from the given number of iterations ago (0 is the latest).
+         */
+        [[nodiscard]] returnType ago (std::size_t IN_AGO) const noexcept {
+            return this->values[(this->count - 1 - IN_AGO) % this->values.size()];
+        }
+    };
+
+    /**
+     * @brief Composable set of stopping tests.
+     *
+     * Tests are checked after every iteration in the order they were added, and the first one that holds stops the
+     * solve (any-of semantics). An empty set selects the legacy test of gradient_decent (see
+     * gradient_decent::set_tolerance()).
+     *
+     * @tparam returnType The type of the objective function's return value.
+     *
+     * @code{.cpp}
+     * // example: stop at a relative change of 1e-8, a projected gradient of 1e-6 or no progress over 5 iterations
+     * gd::convergence_criteria<double> criteria;
+     * criteria.add_relative_change(1e-8).add_gradient_norm(1e-6).add_stall(5, 1e-10);
+     * gradient_operator->set_convergence_criteria(criteria);
+     * auto [minimum_value, minimum_point] = gradient_operator->perform_gradient_decent();
+     * std::cout << gd::to_string(gradient_operator->get_stop_reason()) << std::endl;
+     * @endcode
+     */
+    template <class returnType>
+    class convergence_criteria {
+    public:
+        /**
+         * @brief One stopping test.
+         */
+        struct test {
+            stop_reason kind = stop_reason::none;   ///< The test, named after the reason it reports.
+            returnType threshold {};                ///< The threshold of the test.
+            std::size_t window = 0;                 ///< The number of iterations looked back at (stall test only).
+        };
+
+        /**
+         * @brief Stops when the norm of the gradient, with the components blocked by an active bound removed, is at
+         * most the threshold.
+         */
+        convergence_criteria& add_gradient_norm (returnType IN_THRESHOLD) {
+            this->tests.push_back({stop_reason::gradient_norm, IN_THRESHOLD, 0});
+            return *this;
+        }
+
+        /**
+         * @brief Stops when |f_old - f_new| is at most the threshold.
+         *
+         * Only iterations that accept a step are tested, since a rejected step leaves the value unchanged without the
+         * solve having converged.
+         */
+        convergence_criteria& add_absolute_change (returnType IN_THRESHOLD) {
+            this->tests.push_back({stop_reason::absolute_change, IN_THRESHOLD, 0});
+            return *this;
+        }
+
+        /**
+         * @brief Stops when |f_old - f_new| is at most the threshold times max(|f_old|, |f_new|).
+         *
+         * Only iterations that accept a step are tested (see add_absolute_change()).
+         */
+        convergence_criteria& add_relative_change (returnType IN_THRESHOLD) {
+            this->tests.push_back({stop_reason::relative_change, IN_THRESHOLD, 0});
+            return *this;
+        }
+
+        /**
+         * @brief Stops when the distance between the old and the new optimal point is at most the threshold.
+         *
+         * Only iterations that accept a step are tested (see add_absolute_change()).
+         */
+        convergence_criteria& add_step_size (returnType IN_THRESHOLD) {
+            this->tests.push_back({stop_reason::step_size, IN_THRESHOLD, 0});
+            return *this;
+        }
+
+        /**
+         * @brief Stops when the improvement over the last IN_WINDOW iterations is at most the threshold times
+         * max(|f|, 1).
+         *
+         * Unlike the change tests, a single accepted step that barely improves does not stop the solve; progress has to
+         * stall for the whole window, counting rejected steps.
+         *
+         * @param IN_WINDOW The number of iterations; must be positive.
+         * @param IN_THRESHOLD The relative improvement below which the solve is considered stalled.
+         */
+        convergence_criteria& add_stall (std::size_t IN_WINDOW, returnType IN_THRESHOLD) {
+            this->tests.push_back({stop_reason::stall, IN_THRESHOLD, std::max<std::size_t>(IN_WINDOW, 1)});
+            return *this;
+        }
+
+        /**
+         * @brief Stops when the optimal value is at most the target.
+         */
+        convergence_criteria& add_target_value (returnType IN_TARGET) {
+            this->tests.push_back({stop_reason::target_value, IN_TARGET, 0});
+            return *this;
+        }
+
+        /**
+         * @brief Returns true if no test was added.
+         */
+        [[nodiscard]] bool empty () const noexcept {
+            return this->tests.empty();
+        }
+
+        /**
+         * @brief Returns the tests in the order they are checked.
+         */
+        [[nodiscard]] const std::vector<test>& get_tests () const noexcept {
+            return this->tests;
+        }
+
+        /**
+         * @brief Returns the largest stall window, i.e. the history a solve must keep.
+         */
+        [[nodiscard]] std::size_t history_window () const noexcept {
+            std::size_t window = 0;
+            for (const auto &each : this->tests) {window = std::max(window, each.window);}
+            return window;
+        }
+
+        /**
+         * @brief Checks the tests after an iteration.
+         *
+         * @param IN_SUMMARY What the iteration did.
+         * @param IN_HISTORY The optimal values of the solve so far, including the one after this iteration.
+         * @return The reason of the first test that holds, or stop_reason::none.
+         */
+        [[nodiscard]] stop_reason check (const iteration_summary<returnType> &IN_SUMMARY, const convergence_history<returnType> &IN_HISTORY) const noexcept {
+            const returnType change = std::abs(IN_SUMMARY.previous_value - IN_SUMMARY.value);
+            for (const auto &each : this->tests) {
+                bool fired = false;
+                switch (each.kind) {
+                    case stop_reason::gradient_norm: fired = IN_SUMMARY.gradient_norm <= each.threshold; break;
+                    case stop_reason::absolute_change: fired = IN_SUMMARY.accepted && change <= each.threshold; break;
+                    case stop_reason::relative_change: fired = IN_SUMMARY.accepted && change <= each.threshold * std::max(std::abs(IN_SUMMARY.previous_value), std::abs(IN_SUMMARY.value)); break;
+                    case stop_reason::step_size: fired = IN_SUMMARY.accepted && IN_SUMMARY.step_length <= each.threshold; break;
+                    case stop_reason::stall:
+                        fired = IN_HISTORY.has(each.window) &&
+                                IN_HISTORY.ago(each.window) - IN_SUMMARY.value <= each.threshold * std::max(std::abs(IN_SUMMARY.value), returnType{1});
+                        break;
+                    case stop_reason::target_value: fired = IN_SUMMARY.value <= each.threshold; break;
+                    default: break;
+                }
+                if (fired) {return each.kind;}
+            }
+            return stop_reason::none;
+        }
+
+    private:
+        std::vector<test> tests;    ///< The tests in the order they are checked.
+    };
+}
+
+
+#endif //CONCEPTUAL_CONVERGENCE_CRITERIA_H
@@ -0,0 +1,82 @@
+#define VERBOSITY 0
+
+#include <iostream>
+#include <string>
+
+#include "gradient_decent.h"
+#include "dynamic_gradient_decent.h"
+
+// Solves the example, anisotropic and large-valued problems with a zero step-size test next to relative change and
+// stall tests, with the secant method and with classic back-tracking, and exits with a non-zero status if a solve
+// fails or is stopped by the step-size test. Accepted steps have a positive length, so only a rejected trial (which
+// leaves the point where it was) could fire it. Classic back-tracking is skipped on the large-valued problem, where
+// it runs out of trials (see learning_rate_benchmark.cpp).
+
+double bivarient_function (const double x, const double y) noexcept {
+  constexpr double A = 10;
+  return (A * x * y) / (std::exp(x * x + y * y)) + (5.0/std::exp(1.0));
+}
+
+double anisotropic_quadratic (const double x, const double y) noexcept {
+  return (x - 1) * (x - 1) + 10 * (y - 0.5) * (y - 0.5) + 0.5;
+}
+
+double large_valued_quadratic (const double x, const double y) noexcept {
+  return 1e6 * ((x - 1) * (x - 1) + (y + 0.5) * (y + 0.5)) + 1e7;
+}
+
+gd::convergence_criteria<double> criteria () {
+  gd::convergence_criteria<double> criteria;
+  criteria.add_step_size(0.0).add_relative_change(1e-9).add_stall(10, 1e-12);
+  return criteria;
+}
+
+template <class solverType>
+int check (const std::string &IN_NAME, solverType &IN_SOLVER, const bool classic) {
+  IN_SOLVER.set_convergence_criteria(criteria());
+  if (classic) IN_SOLVER.toggle_classic_gradient_algo();
+  try {
+    IN_SOLVER.perform_gradient_decent();
+  } catch (std::exception &e) {
+    std::cerr << IN_NAME << (classic ? " (classic)" : " (secant)") << " failed: " << e.what() << std::endl;
+    return 1;
+  }
+  if (IN_SOLVER.get_stop_reason() != gd::stop_reason::step_size) return 0;
+  std::cerr << IN_NAME << (classic ? " (classic)" : " (secant)") << " stopped by step_size after "
+            << IN_SOLVER.get_func_call_count() << " calls" << std::endl;
+  return 1;
+}
+
+int main () {
+  struct problem {
+    std::string name;
+    double (*function)(double, double);
+    double x;
+    double y;
+    bool classic;
+  };
+  const problem problems[] = {
+    {"example", bivarient_function, 1.6, -1.2, true},
+    {"anisotropic", anisotropic_quadratic, 1.8, 1.5, true},
+    {"large valued", large_valued_quadratic, 1.6, -1.2, false},
+  };
+
+  int failures = 0;
+  for (const auto &each : problems) {
+    for (const bool classic : {false, true}) {
+      if (classic && !each.classic) continue;
+      gd::gradient_decent<double, double, double> gradient_operator(each.function, each.x, each.y);
+      gradient_operator.add_lower_bounds(std::make_tuple(-2.0, -2.0));
+      gradient_operator.add_upper_bounds(std::make_tuple(2.0, 2.0));
+      failures += check(each.name, gradient_operator, classic);
+
+      const auto function = each.function;
+      gd::dynamic_gradient_decent<double> dynamic_operator([function] (std::span<const double> IN_X) {return function(IN_X[0], IN_X[1]);}, {each.x, each.y});
+      dynamic_operator.add_lower_bounds({-2.0, -2.0});
+      dynamic_operator.add_upper_bounds({2.0, 2.0});
+      failures += check(each.name + " dynamic", dynamic_operator, classic);
+    }
+  }
+  if (failures == 0) std::cout << "No solve was stopped by a rejected trial" << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file counter_rng.h
+ * @brief Header file containing a counter-based random number generator for reproducible parallel sampling.
+ *
+ * A sequential generator (e.g. std::mt19937_64) yields different samples to different tasks depending on the
+ * order in which they draw, and std::uniform_real_distribution is implementation defined. The counter-based
+ * generator instead maps (seed, stream, counter) to a random value with a fixed hash, so every sample is the same
+ * regardless of thread count, scheduling or standard library.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_COUNTER_RNG_H
+#define CONCEPTUAL_COUNTER_RNG_H
+
+#include <cstdint>
+
+namespace aux {
+    /**
+     * @brief Stateless counter-based random number generator (SplitMix64 finaliser).
+     *
+     * Every (stream, counter) pair names one sample; streams are independent, so parallel tasks each draw from
+     * their own stream (e.g. the index of a start point) without coordination.
+     *
+     * @code{.cpp}
+     * // example
+     * aux::counter_rng rng(42);
+     * double u = rng.uniform(start_index, coordinate);   // in [0, 1)
+     * @endcode
+     */
+    class counter_rng {
+    public:
+        /**
+         * @brief Constructs the generator.
+         *
+         * @param IN_SEED The seed.
+         */
+        explicit constexpr counter_rng (std::uint64_t IN_SEED) noexcept : seed(IN_SEED) {}
+
+        /**
+         * @brief Returns the 64 random bits of a sample.
+         *
+         * @param IN_STREAM The stream.
+         * @param IN_COUNTER The counter within the stream.
+         */
+        [[nodiscard]] constexpr std::uint64_t bits (std::uint64_t IN_STREAM, std::uint64_t IN_COUNTER) const noexcept {
+            return mix(mix(this->seed ^ mix(IN_STREAM + golden)) + IN_COUNTER * golden);
+        }
+
+        /**
+         * @brief Returns a sample uniformly distributed in [0, 1), with 53 random bits.
+         *
+         * @param IN_STREAM The stream.
+         * @param IN_COUNTER The counter within the stream.
+         */
+        [[nodiscard]] constexpr double uniform (std::uint64_t IN_STREAM, std::uint64_t IN_COUNTER) const noexcept {
+            return static_cast<double>(this->bits(IN_STREAM, IN_COUNTER) >> 11) * 0x1.0p-53;
+        }
+
+    private:
+        static constexpr std::uint64_t golden = 0x9E3779B97F4A7C15ULL;
+        std::uint64_t seed;
+
+        static constexpr std::uint64_t mix (std::uint64_t IN_VALUE) noexcept {
+            IN_VALUE = (IN_VALUE ^ (IN_VALUE >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            IN_VALUE = (IN_VALUE ^ (IN_VALUE >> 27)) * 0x94D049BB133111EBULL;
+            return IN_VALUE ^ (IN_VALUE >> 31);
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_COUNTER_RNG_H
@@ -0,0 +1,67 @@
+#define VERBOSITY 0
+
+#include <csignal>
+#include <filesystem>
+#include <iostream>
+#include <thread>
+
+#include <pthread.h>
+
+#include "optimisation_daemon.h"
+
+double bivarient_function (std::span<const double> parameters, const double x, const double y) noexcept {
+  const double A = parameters.empty() ? 10.0 : parameters[0];
+  return (A * x * y) / (std::exp(x * x + y * y)) + (5.0/std::exp(1.0));
+}
+
+// Loads every "<id>.so" in the plug-in directory, e.g. plugins/42.so is served as objective 42.
+void load_plugins (gd::optimisation_daemon &daemon, const std::filesystem::path &directory) {
+  if (directory.empty() || !std::filesystem::is_directory(directory)) return;
+  for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+    if (entry.path().extension() != ".so") continue;
+    try {
+      const auto id = static_cast<std::uint32_t>(std::stoul(entry.path().stem().string()));
+      daemon.load_plugin(id, entry.path().string());
+      std::cout << "Loaded plug-in " << entry.path() << " as objective " << id << std::endl;
+    } catch (std::exception &e) {
+      std::cerr << "Skipping plug-in " << entry.path() << ": " << e.what() << std::endl;
+    }
+  }
+}
+
+int main (int argc, char **argv) {
+  const std::string path = argc > 1 ? argv[1] : "/tmp/gradient_decent.sock";
+  const std::size_t threads = argc > 2 ? std::stoul(argv[2]) : std::max(1U, std::thread::hardware_concurrency());
+  const std::filesystem::path plugin_directory = argc > 3 ? argv[3] : "";
+  const auto placement = argc > 4 && std::string(argv[4]) == "numa" ? aux::thread_placement::numa : aux::thread_placement::none;
+
+  // Signals are handled by a dedicated thread: SIGHUP reloads the plug-ins, SIGINT/SIGTERM stop the daemon.
+  sigset_t signals;
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  sigaddset(&signals, SIGHUP);
+  pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+  gd::optimisation_daemon daemon(threads, placement);
+  daemon.register_objective<double, double, double>(1, bivarient_function);
+  load_plugins(daemon, plugin_directory);
+
+  std::thread signal_thread([&] () {
+    int signal = 0;
+    while (sigwait(&signals, &signal) == 0) {
+      if (signal != SIGHUP) break;
+      load_plugins(daemon, plugin_directory);
+    }
+    daemon.stop();
+  });
+
+  std::cout << "Serving on " << path << " with " << threads << " workers" << std::endl;
+  daemon.serve(path);
+  pthread_kill(signal_thread.native_handle(), SIGTERM);
+  signal_thread.join();
+
+  const auto metrics = daemon.get_metrics();
+  std::cout << "Served " << metrics.served << " requests (" << metrics.failed << " failed), mean latency "
+            << metrics.mean_latency_us << " us, max latency " << metrics.max_latency_us << " us" << std::endl;
+}
@@ -0,0 +1,74 @@
+#define VERBOSITY 0
+
+#include <bit>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+
+#include "gradient_decent.h"
+
+// Solves the example problem with constraints on 1, 2, 4 and 8 worker threads in deterministic mode and
+// exits with a non-zero status unless every run returns the same bits and the same function call count.
+
+double bivarient_function (const double x, const double y) noexcept {
+  constexpr double A = 10;
+  return (A * x * y) / (std::exp(x * x + y * y)) + (5.0/std::exp(1.0));
+}
+
+double circle (const double x, const double y) noexcept {return x * x + y * y;}
+double diagonal (const double x, const double y) noexcept {return x + y;}
+double slanted (const double x, const double y) noexcept {return 0.3 * x + y;}
+
+struct solve_record {
+  std::uint64_t value;
+  std::uint64_t x;
+  std::uint64_t y;
+  std::size_t calls;
+};
+
+solve_record solve_with (const std::size_t threads, const bool concurrent) {
+  using constraints = aux::constraints_system<double, double, double>;
+  constraints::create_constraint<double(double, double), double> c1(circle, "<", 4.5, 0.001F);
+  constraints::create_constraint<double(double, double), double> c2(diagonal, "<", 0.5, 0.001F);
+  constraints::create_constraint<double(double, double), double> c3(slanted, "<", 0.9, 0.001F);
+
+  gd::gradient_decent<double, double, double> gradient_operator(bivarient_function, 1.6, -1.2);
+  gradient_operator.add_lower_bounds(std::make_tuple(-2.0, -2.0));
+  gradient_operator.add_upper_bounds(std::make_tuple(2.0, 2.0));
+  gradient_operator.set_tolerance(1e-3);
+  gradient_operator.add_constraints(c1, c2, c3);
+  if (concurrent) {
+    gradient_operator.toggle_parallel_constraints();
+    gradient_operator.toggle_parallel_derivatives();
+    gradient_operator.toggle_speculative_derivatives();
+    gradient_operator.toggle_constraint_short_circuit();
+  }
+  gradient_operator.toggle_deterministic();
+  gradient_operator.set_scheduler(std::make_shared<aux::work_stealing_scheduler>(threads));
+
+  const auto [minimum_value, minimum_point] = gradient_operator.perform_gradient_decent();
+  return {std::bit_cast<std::uint64_t>(minimum_value),
+          std::bit_cast<std::uint64_t>(std::get<0>(minimum_point)),
+          std::bit_cast<std::uint64_t>(std::get<1>(minimum_point)),
+          gradient_operator.get_func_call_count()};
+}
+
+int main () {
+  int failures = 0;
+  for (const bool concurrent : {false, true}) {
+    const solve_record reference = solve_with(1, concurrent);
+    for (const std::size_t threads : {2, 4, 8}) {
+      for (int repeat = 0; repeat < 5; ++repeat) {
+        const solve_record record = solve_with(threads, concurrent);
+        if (record.value != reference.value || record.x != reference.x || record.y != reference.y || record.calls != reference.calls) {
+          std::cerr << "Mismatch with " << threads << " threads (concurrent = " << concurrent << "): "
+                    << std::bit_cast<double>(record.value) << " after " << record.calls << " calls, expected "
+                    << std::bit_cast<double>(reference.value) << " after " << reference.calls << " calls" << std::endl;
+          ++failures;
+        }
+      }
+    }
+  }
+  if (failures == 0) std::cout << "Deterministic results match across thread counts" << std::endl;
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,595 @@
+/**
+ * @file dynamic_gradient_decent.h
+ * @brief Header file defining the runtime-dimension variant of the gradient descent optimiser.
+ *
+ * gd::gradient_decent is a template over the objective's argument types, so every new objective needs a
+ * recompilation. gd::dynamic_gradient_decent runs the same algorithm (finite difference derivatives, secant
+ * method scaling or classic back-tracking, derivative scaling, variable scaling, learning rate policies, convergence
+ * criteria and bounds projection) on points whose dimension is only known at runtime, e.g. objectives loaded from
+ * plug-ins (see objective_plugin.h).
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_DYNAMIC_GRADIENT_DECENT_H
+#define CONCEPTUAL_DYNAMIC_GRADIENT_DECENT_H
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "gradient_decent.h"
+
+namespace gd {
+    /**
+     * @brief Gradient descent optimiser over a runtime number of variables.
+     *
+     * The dynamic_gradient_decent class mirrors gd::gradient_decent for objectives of the form
+     * `returnType(std::span<const returnType>)`. Optionally, a batched objective is used to evaluate all points of
+     * the finite difference stencil in one call, and an analytic gradient replaces finite differences altogether.
+     *
+     * @tparam returnType The type of the objective function's return value and of the optimisation variables.
+     *
+     * @note Unlike gd::gradient_decent, the bounds default to the whole representable range. Constraints, joint
+     * evaluators, equality projection, feasibility restoration, the projected arc, speculative and asynchronous
+     * evaluation, deterministic mode, iteration callbacks and the result and shared evaluation caches are only
+     * available in gd::gradient_decent; this class has no setters for them.
+     */
+    template <class returnType>
+    class dynamic_gradient_decent {
+    public:
+        using point_type = std::vector<returnType>;
+        using function_type = std::function<returnType(std::span<const returnType>)>;
+        using batch_function_type = std::function<void(std::span<const returnType>, std::span<returnType>)>;
+        using gradient_function_type = std::function<bool(std::span<const returnType>, std::span<returnType>)>;
+
+        /**
+         * @brief Constructs the optimiser with an objective function and an initial guess.
+         *
+         * @param IN_FUNC The objective function.
+         * @param IN_GUESS The initial guess; its size sets the dimension of the problem.
+         */
+        dynamic_gradient_decent (function_type IN_FUNC, point_type IN_GUESS) :
+                function(std::move(IN_FUNC)),
+                lower_bounds(IN_GUESS.size(), std::numeric_limits<returnType>::lowest()),
+                upper_bounds(IN_GUESS.size(), std::numeric_limits<returnType>::max()) {
+            this->change_initial_guess(std::move(IN_GUESS));
+            VERBOSE_PRINT("Dynamic Gradient Decent instance created with " << this->dimension() << " variables...");
+        }
+
+        virtual ~dynamic_gradient_decent () = default;
+
+        /**
+         * @brief Returns the number of optimisation variables.
+         */
+        [[nodiscard]] std::size_t dimension () const noexcept {
+            return this->optimal_point.size();
+        }
+
+        /**
+         * @brief Sets a batched objective used for the finite difference stencil.
+         *
+         * The batched objective receives the points back to back and writes one value per point.
+         */
+        void set_batch_objective (batch_function_type IN_FUNC) noexcept {
+            this->batch_function = std::move(IN_FUNC);
+        }
+
+        /**
+         * @brief Sets an analytic gradient used instead of finite differences.
+         *
+         * The gradient function returns false to fall back to finite differences at that point.
+         */
+        void set_gradient (gradient_function_type IN_FUNC) noexcept {
+            this->gradient_function = std::move(IN_FUNC);
+        }
+
+        /**
+         * @brief Sets the maximum number of evaluations for optimisation (default: 1000).
+         */
+        void set_max_eval (std::size_t IN_MAX_EVAL) noexcept {
+            this->max_eval = IN_MAX_EVAL;
+        }
+
+        /**
+         * @brief Sets the tolerance for convergence criteria (default: 0.00001).
+         */
+        void set_tolerance (returnType IN_TOLERANCE) noexcept {
+            this->tolerance = IN_TOLERANCE;
+        }
+
+        /**
+         * @brief Sets the lower bounds of the optimisation variables.
+         */
+        void add_lower_bounds (point_type IN_LOWER_BOUNDS) {
+            if (IN_LOWER_BOUNDS.size() != this->dimension()) {throw std::runtime_error("Length of lower bounds does not match the dimension");}
+            this->lower_bounds = std::move(IN_LOWER_BOUNDS);
+        }
+
+        /**
+         * @brief Sets the upper bounds of the optimisation variables.
+         */
+        void add_upper_bounds (point_type IN_UPPER_BOUNDS) {
+            if (IN_UPPER_BOUNDS.size() != this->dimension()) {throw std::runtime_error("Length of upper bounds does not match the dimension");}
+            this->upper_bounds = std::move(IN_UPPER_BOUNDS);
+        }
+
+        /**
+         * @brief Sets the initial learning rate (default: 1.0).
+         */
+        void set_initial_learning_rate (returnType IN_RATE) noexcept {
+            this->learning_rate = IN_RATE;
+            this->initial_learning_rate = IN_RATE;
+        }
+
+        /**
+         * @brief Toggles between classic gradient descent (back-tracking) and secant method scaling.
+         */
+        void toggle_classic_gradient_algo () {
+            this->use_classic_gd = !this->use_classic_gd;
+            if (this->use_classic_gd) { VERBOSE_PRINT("USING CLASSIC GRADIENT DECENT ALGORITHM..."); }
+            else { VERBOSE_PRINT("USING SECANT SCALING APPROACH"); }
+        }
+
+        /**
+         * @brief Toggles derivative-based scaling of the learning rate.
+         */
+        void toggle_derivative_scaling () {
+            this->use_scaling = !this->use_scaling;
+            if (this->use_scaling) {VERBOSE_PRINT("USING DERIVATIVE BASED LEARNING RATE SCALING");}
+            else {VERBOSE_PRINT("NOT USING DERIVATIVE BASED LEARNING RATE SCALING");}
+        }
+
+        /**
+         * @brief Sets the scheduler used for parallel finite differences (default: the shared scheduler).
+         */
+        void set_scheduler (std::shared_ptr<aux::work_stealing_scheduler> IN_SCHEDULER) noexcept {
+            this->scheduler = std::move(IN_SCHEDULER);
+        }
+
+        /**
+         * @brief Toggles parallel evaluation of the finite difference stencil (ignored with a batched objective).
+         *
+         * @note By default this is off. The objective function must be thread-safe.
+         */
+        void toggle_parallel_derivatives () {
+            this->use_parallel_derivatives = !this->use_parallel_derivatives;
+            if (this->use_parallel_derivatives) {VERBOSE_PRINT("USING PARALLEL FINITE DIFFERENCES");}
+            else {VERBOSE_PRINT("NOT USING PARALLEL FINITE DIFFERENCES");}
+        }
+
+        /**
+         * @brief Sets the normalisation of the variables (see gd::gradient_decent::set_variable_scaling()).
+         *
+         * @note Bound scaling requires finite lower and upper bounds on every variable; perform_gradient_decent()
+         * throws a runtime_error otherwise.
+         */
+        void set_variable_scaling (gd::variable_scaling IN_SCALING) noexcept {
+            this->variable_scaling_ = IN_SCALING;
+            if (IN_SCALING == gd::variable_scaling::bounds) {VERBOSE_PRINT("USING BOUND BASED VARIABLE SCALING");}
+            else if (IN_SCALING == gd::variable_scaling::curvature) {VERBOSE_PRINT("USING CURVATURE BASED VARIABLE SCALING");}
+            else {VERBOSE_PRINT("NOT USING VARIABLE SCALING");}
+        }
+
+        /**
+         * @brief Sets the learning rate policy (see gd::gradient_decent::set_learning_rate_policy()).
+         *
+         * @param IN_POLICY The policy, or nullptr to restore the default.
+         */
+        void set_learning_rate_policy (std::shared_ptr<const gd::learning_rate_policy<returnType>> IN_POLICY) noexcept {
+            this->learning_rate_policy_ = std::move(IN_POLICY);
+        }
+
+        /**
+         * @brief Sets the stopping tests (see gd::gradient_decent::set_convergence_criteria()).
+         *
+         * @param IN_CRITERIA The tests; an empty set restores the legacy test.
+         */
+        void set_convergence_criteria (gd::convergence_criteria<returnType> IN_CRITERIA) {
+            this->convergence_criteria_ = std::move(IN_CRITERIA);
+        }
+
+        /**
+         * @brief Returns the stopping test that ended the last perform_gradient_decent().
+         */
+        [[nodiscard]] gd::stop_reason get_stop_reason () const noexcept {
+            return this->stopped_by;
+        }
+
+        /**
+         * @brief Changes the initial guess and resets the run state of the optimiser.
+         *
+         * @param IN_GUESS The new initial guess; it must have the dimension of the problem.
+         */
+        void change_initial_guess (point_type IN_GUESS) {
+            if (!this->optimal_point.empty() && IN_GUESS.size() != this->dimension()) {throw std::runtime_error("Length of initial guess does not match the dimension");}
+            this->optimal_point = std::move(IN_GUESS);
+            this->old_optimal_point = this->optimal_point;
+            this->derivatives.assign(this->dimension(), returnType{});
+            this->derivative_high.assign(this->dimension(), returnType{});
+            this->step_scales.assign(this->dimension(), 1.0);
+            this->preconditioner.assign(this->dimension(), 1.0);
+            this->inverse_curvature.assign(this->dimension(), 0.0);
+            this->previous_derivatives_valid = false;
+            this->learning_rate = this->initial_learning_rate;
+            this->current_tolerance = 0.002F;
+            this->first_iteration_settings = true;
+            this->func_call_count = 0;
+            this->optimal_val = this->eval_func_at(this->optimal_point);
+        }
+
+        /**
+         * @brief Returns the number of times the objective function was called since the last (re)start.
+         */
+        [[nodiscard]] std::size_t get_func_call_count () const noexcept {
+            return this->func_call_count;
+        }
+
+        /**
+         * @brief Performs gradient descent optimisation.
+         *
+         * Runs the same iteration as gd::gradient_decent::perform_gradient_decent().
+         *
+         * @return A pair containing the optimal value and the optimal point.
+         *
+         * @note A runtime_error is thrown if bound scaling is selected without finite bounds on every variable.
+         */
+        std::pair<returnType, point_type> perform_gradient_decent () {
+            if (this->variable_scaling_ == gd::variable_scaling::bounds) {
+                for (std::size_t i = 0; i < this->dimension(); ++i) {
+                    if (!std::isfinite(this->upper_bounds[i] - this->lower_bounds[i])) {
+                        std::cerr << "Bound scaling requires finite lower and upper bounds on every variable" << std::endl;
+                        throw std::runtime_error("Bound scaling requires finite lower and upper bounds on every variable");
+                    }
+                }
+            }
+            std::size_t eval = 0;
+            this->stopped_by = gd::stop_reason::none;
+            this->history.reset(this->convergence_criteria_.history_window());
+            this->history.push(this->optimal_val);
+            do {
+                this->old_optimal_point = this->optimal_point;
+                VERBOSE_PRINT("iteration @" << std::to_string(eval) << " with optimal val at " << this->optimal_val);
+                std::fill(this->step_scales.begin(), this->step_scales.end(), 1.0);
+                this->calculate_derivatives_at(this->optimal_point);
+                const point_type current = this->optimal_point;
+                this->previous_point = this->optimal_point;
+                this->previous_derivatives = this->derivatives;
+                this->previous_derivatives_valid = true;
+                this->use_classic_gd ? this->step_forward_with_back_tracking(current) : this->step_forward_with_secant_method(current);
+                this->first_iteration_settings = false;
+            } while (eval++ < this->max_eval && !this->has_converged());
+
+            if (this->stopped_by == gd::stop_reason::none) {
+                if (!this->convergence_criteria_.empty() || this->current_tolerance > this->tolerance) {
+                    throw std::runtime_error("Gradient descent failed to converge");
+                }
+                this->stopped_by = gd::stop_reason::max_eval;
+            }
+            VERBOSE_PRINT("GD STOPPED BY " << gd::to_string(this->stopped_by));
+            VERBOSE_PRINT("GD CONVERGED with optimal value: " << this->optimal_val);
+            VERBOSE_PRINT("Number of times fun called: " << this->func_call_count);
+            return std::make_pair(this->optimal_val, this->optimal_point);
+        }
+
+    protected:
+        function_type function;                     ///< The objective function.
+        batch_function_type batch_function;         ///< Optional batched objective function.
+        gradient_function_type gradient_function;   ///< Optional analytic gradient.
+        point_type optimal_point;
+        point_type old_optimal_point;
+        returnType optimal_val{};
+        std::size_t max_eval = 1000;
+        returnType tolerance = 0.00001F;
+        returnType current_tolerance = 0.002F;
+        point_type lower_bounds;
+        point_type upper_bounds;
+        returnType learning_rate = 1.0;
+        returnType initial_learning_rate = 1.0;
+        returnType finite_difference_step = 0.001;
+        point_type step_scales;
+        point_type derivatives;
+        point_type derivative_high;
+        bool first_iteration_settings = true;
+        bool use_classic_gd = false;
+        bool use_scaling = false;
+        bool use_parallel_derivatives = false;
+        gd::variable_scaling variable_scaling_ = gd::variable_scaling::none;   ///< The normalisation of the variables.
+        point_type preconditioner;                                              ///< Diagonal preconditioner, one factor per variable.
+        point_type inverse_curvature;                                           ///< Secant estimates of the inverse diagonal curvature (0: none yet).
+        point_type previous_point;                                              ///< The point of the last derivative calculation.
+        point_type previous_derivatives;                                        ///< The derivatives at previous_point.
+        bool previous_derivatives_valid = false;                                ///< True once previous_point and previous_derivatives are set.
+        std::shared_ptr<const gd::learning_rate_policy<returnType>> learning_rate_policy_;   ///< The learning rate policy (nullptr: the default).
+        gd::convergence_criteria<returnType> convergence_criteria_;             ///< The stopping tests (empty: the legacy test).
+        gd::convergence_history<returnType> history;                            ///< The optimal values for the stall test.
+        gd::stop_reason stopped_by = gd::stop_reason::none;                     ///< The stopping test that ended the last solve.
+        std::size_t func_call_count = 0;
+        std::shared_ptr<aux::work_stealing_scheduler> scheduler;   ///< Scheduler of the parallel stencil (optional).
+
+        returnType eval_func_at (std::span<const returnType> IN_POINT) {
+            std::atomic_ref<std::size_t>(this->func_call_count).fetch_add(1, std::memory_order_relaxed);
+            return this->function(IN_POINT);
+        }
+
+        /**
+         * @brief Computes the derivatives at a point (analytic gradient, batched, parallel or serial finite differences).
+         */
+        void calculate_derivatives_at (const point_type &IN_POINT) {
+            const std::size_t n = this->dimension();
+            if (!(this->gradient_function && this->gradient_function(IN_POINT, this->derivatives))) {
+                point_type stencil(n * n);
+                point_type values(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::copy(IN_POINT.begin(), IN_POINT.end(), stencil.begin() + static_cast<std::ptrdiff_t>(i * n));
+                    stencil[i * n + i] *= 1.0F + this->finite_difference_step * this->step_scales[i];
+                }
+                if (this->batch_function) {
+                    this->func_call_count += n;
+                    this->batch_function(stencil, values);
+                } else if (this->use_parallel_derivatives) {
+                    aux::parallel_for(this->scheduler ? *this->scheduler : *aux::work_stealing_scheduler::shared(), n, [this, &stencil, &values, n] (std::size_t i) {
+                        values[i] = this->eval_func_at(std::span<const returnType>(stencil).subspan(i * n, n));
+                    });
+                } else {
+                    for (std::size_t i = 0; i < n; ++i) {values[i] = this->eval_func_at(std::span<const returnType>(stencil).subspan(i * n, n));}
+                }
+                for (std::size_t i = 0; i < n; ++i) {
+                    this->derivatives[i] = (values[i] - this->optimal_val) / (IN_POINT[i] * this->finite_difference_step * this->step_scales[i]);
+                }
+            }
+
+            gd::learning_rate_context<returnType> context;
+            context.learning_rate = this->learning_rate;
+            context.first_iteration = this->first_iteration_settings;
+            for (std::size_t i = 0; i < n; ++i) {
+                const returnType derivative = std::abs(this->derivatives[i]);
+                const returnType high = std::abs(this->derivative_high[i]);
+                if (derivative > high) {
+                    const returnType growth = high > 0 ? derivative / high : std::numeric_limits<returnType>::infinity();
+                    context.growth = context.new_high ? std::max(context.growth, growth) : growth;
+                    context.new_high = true;
+                    this->derivative_high[i] = this->derivatives[i];
+                }
+            }
+            if (this->use_scaling && !this->first_iteration_settings) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    this->step_scales[i] *= std::sqrt(std::abs(this->derivatives[i] / this->derivative_high[i]));
+                    this->step_scales[i] = std::max(this->step_scales[i], this->tolerance);
+                }
+            }
+            this->update_preconditioner();
+            if (this->previous_derivatives_valid) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    const returnType step = this->optimal_point[i] - this->previous_point[i];
+                    context.step_dot_step += step * step / (this->step_scales[i] * this->preconditioner[i]);
+                    context.step_dot_change += step * (this->derivatives[i] - this->previous_derivatives[i]);
+                }
+            }
+            static const gd::reset_on_new_high<returnType> default_policy;
+            this->learning_rate = (this->learning_rate_policy_ ? *this->learning_rate_policy_ : static_cast<const gd::learning_rate_policy<returnType>&>(default_policy)).next(context);
+        }
+
+        /**
+         * @brief Updates the diagonal preconditioner after the derivatives are calculated (see
+         * gd::gradient_decent::update_preconditioner()).
+         */
+        void update_preconditioner () {
+            const std::size_t n = this->dimension();
+            if (this->variable_scaling_ == gd::variable_scaling::bounds) {
+                for (std::size_t i = 0; i < n; ++i) {this->preconditioner[i] = (this->upper_bounds[i] - this->lower_bounds[i]) * (this->upper_bounds[i] - this->lower_bounds[i]);}
+            } else if (this->variable_scaling_ == gd::variable_scaling::curvature) {
+                if (this->previous_derivatives_valid) {
+                    for (std::size_t i = 0; i < n; ++i) {
+                        const returnType step = this->optimal_point[i] - this->previous_point[i];
+                        const returnType inverse = step / (this->derivatives[i] - this->previous_derivatives[i]);
+                        if (step != 0 && std::isfinite(inverse) && inverse > 0) {this->inverse_curvature[i] = inverse;}
+                    }
+                }
+                returnType log_sum = 0;
+                std::size_t known = 0;
+                for (const auto &each : this->inverse_curvature) {
+                    if (each > 0) {log_sum += std::log(each); ++known;}
+                }
+                const returnType fill = known ? std::exp(log_sum / static_cast<returnType>(known)) : returnType{1};
+                for (std::size_t i = 0; i < n; ++i) {this->preconditioner[i] = this->inverse_curvature[i] > 0 ? this->inverse_curvature[i] : fill;}
+            }
+        }
+
+        /**
+         * @brief Creates the bounds-projected point `IN_POINT - IN_RATE * step_scales * preconditioner * derivatives`.
+         */
+        point_type create_next_point (const point_type &IN_POINT, returnType IN_RATE) const {
+            point_type next(IN_POINT.size());
+            for (std::size_t i = 0; i < next.size(); ++i) {
+                next[i] = std::clamp(IN_POINT[i] - this->derivatives[i] * IN_RATE * this->step_scales[i] * this->preconditioner[i], this->lower_bounds[i], this->upper_bounds[i]);
+            }
+            return next;
+        }
+
+        void step_forward_with_secant_method (const point_type &IN_POINT) {
+            this->optimal_point = this->create_next_point(IN_POINT, this->learning_rate);
+            const returnType test_optimal = this->eval_func_at(this->optimal_point);
+            if (test_optimal > this->optimal_val) {
+                point_type probe_point = IN_POINT;
+                returnType probe_val = this->optimal_val;
+                this->learning_rate += this->secant_learning_rate_scaling(IN_POINT, test_optimal - this->optimal_val, this->optimal_val, probe_point, probe_val);
+                this->learning_rate *= 0.5;
+                if (!(probe_val < this->optimal_val)) {
+                    this->optimal_point = IN_POINT;
+                    this->current_tolerance = 0;
+                    return;
+                }
+                this->optimal_point = this->create_next_point(IN_POINT, this->learning_rate);
+                const returnType new_val = this->optimal_point == probe_point ? probe_val : this->eval_func_at(this->optimal_point);
+                if (probe_val < new_val) {
+                    this->optimal_point = std::move(probe_point);
+                    this->current_tolerance = this->optimal_val - probe_val;
+                    this->optimal_val = probe_val;
+                } else {
+                    this->current_tolerance = this->optimal_val - new_val;
+                    this->optimal_val = new_val;
+                }
+            } else {
+                this->current_tolerance = std::abs(this->optimal_val - test_optimal);
+                this->optimal_val = test_optimal;
+            }
+        }
+
+        void step_forward_with_back_tracking (const point_type &IN_POINT) {
+            std::size_t iterative_count = 0;
+            constexpr std::size_t iterative_count_max = 1000;
+            do {
+                this->optimal_point = this->create_next_point(IN_POINT, this->learning_rate);
+                const returnType test_optimal = this->eval_func_at(this->optimal_point);
+                if (test_optimal > this->optimal_val) {
+                    if (!this->resolves_step(IN_POINT, this->learning_rate)) {
+                        // shorter steps are below the resolution of the finite difference derivatives
+                        this->optimal_point = IN_POINT;
+                        this->current_tolerance = 0;
+                        return;
+                    }
+                    this->learning_rate *= 0.99;
+                } else {
+                    this->current_tolerance = std::abs(this->optimal_val - test_optimal);
+                    this->optimal_val = test_optimal;
+                    break;
+                }
+            } while (iterative_count++ < iterative_count_max);
+
+            if (iterative_count >= iterative_count_max) {
+                throw std::runtime_error("Cannot find next point using back-tracking algorithm");
+            }
+        }
+
+        /**
+         * @brief Returns true if a step of the given learning rate moves some variable by at least its finite
+         * difference spacing (see gd::gradient_decent::resolves_step()).
+         */
+        bool resolves_step (const point_type &IN_POINT, returnType IN_RATE) const noexcept {
+            for (std::size_t i = 0; i < IN_POINT.size(); ++i) {
+                if (std::abs(IN_RATE * this->step_scales[i] * this->preconditioner[i] * this->derivatives[i]) >= this->finite_difference_step * this->step_scales[i] * std::abs(IN_POINT[i])) {return true;}
+            }
+            return false;
+        }
+
+        /**
+         * @brief Bracketed (Illinois) secant search for the mirror point along the current step (see
+         * gd::gradient_decent::secant_learning_rate_scaling()).
+         *
+         * @param IN_POINT The start point of the step.
+         * @param IN_CURRENT_VAL The value at the rejected trial point minus the required value.
+         * @param IN_REQUIRED_VAL The value at the start point.
+         * @param OUT_BEST_POINT The probed point with the lowest value, if it is lower than OUT_BEST_VAL on entry.
+         * @param OUT_BEST_VAL The value at OUT_BEST_POINT.
+         * @return The adjustment of the learning rate.
+         */
+        returnType secant_learning_rate_scaling (const point_type &IN_POINT, returnType IN_CURRENT_VAL, const returnType IN_REQUIRED_VAL, point_type &OUT_BEST_POINT, returnType &OUT_BEST_VAL) {
+            constexpr std::size_t bracket_max = 64;
+            constexpr std::size_t iterative_max = 100;
+            constexpr returnType relative_tolerance = 0.001;
+            const returnType rate = this->learning_rate;
+            auto find_new_val = [this, &IN_POINT, &OUT_BEST_POINT, &OUT_BEST_VAL, rate, IN_REQUIRED_VAL] (returnType IN_RATE) {
+                point_type point(IN_POINT.size());
+                for (std::size_t i = 0; i < point.size(); ++i) {
+                    point[i] = std::clamp(IN_POINT[i] - (rate + IN_RATE) * this->step_scales[i] * this->preconditioner[i] * this->derivatives[i], this->lower_bounds[i], this->upper_bounds[i]);
+                }
+                const returnType value = this->eval_func_at(point);
+                if (value < OUT_BEST_VAL) {
+                    OUT_BEST_POINT = std::move(point);
+                    OUT_BEST_VAL = value;
+                }
+                return value - IN_REQUIRED_VAL;
+            };
+
+            returnType slope = 0;
+            for (std::size_t i = 0; i < IN_POINT.size(); ++i) {slope -= this->step_scales[i] * this->preconditioner[i] * this->derivatives[i] * this->derivatives[i];}
+            const returnType curvature = (IN_CURRENT_VAL - slope * rate) / (rate * rate);
+            const returnType minimiser = -slope / (2 * curvature);
+            returnType above_rate = 0.0;
+            returnType above_val = IN_CURRENT_VAL;
+            returnType below_rate = 0.0;
+            returnType below_val = 0.0;
+            returnType step = (minimiser > 0 && minimiser < rate) ? 2 * minimiser : rate;
+            std::size_t bracket_count = 0;
+            do {
+                step *= 0.5;
+                below_rate = step - rate;
+                below_val = find_new_val(below_rate);
+            } while (!(below_val < 0) && ++bracket_count < bracket_max && this->resolves_step(IN_POINT, step));
+            if (!(below_val < 0)) {return below_rate;}
+
+            returnType new_rate = below_rate;
+            int retained = 0;   // -1: the end below was retained last, +1: the end above was retained last
+            for (std::size_t iterative_count = 0; iterative_count < iterative_max; ++iterative_count) {
+                new_rate = (below_val * above_rate - above_val * below_rate) / (below_val - above_val);
+                const returnType new_val = find_new_val(new_rate);
+                if (new_val < 0) {
+                    below_rate = new_rate;
+                    below_val = new_val;
+                    if (retained == +1) {above_val *= 0.5;}
+                    retained = +1;
+                } else if (new_val > 0) {
+                    above_rate = new_rate;
+                    above_val = new_val;
+                    if (retained == -1) {below_val *= 0.5;}
+                    retained = -1;
+                } else {
+                    break;
+                }
+                if (std::abs(above_rate - below_rate) <= relative_tolerance * std::abs(rate + new_rate)) {break;}
+            }
+            return new_rate;
+        }
+
+        returnType get_tolerance () const {
+            returnType sum{};
+            for (std::size_t i = 0; i < this->dimension(); ++i) {
+                sum += (this->optimal_point[i] - this->old_optimal_point[i]) * (this->optimal_point[i] - this->old_optimal_point[i]);
+            }
+            return this->current_tolerance + std::sqrt(sum);
+        }
+
+        /**
+         * @brief Checks the stopping tests after an iteration and records the one that fired (see
+         * gd::gradient_decent::has_converged()).
+         */
+        bool has_converged () {
+            if (this->convergence_criteria_.empty()) {
+                if (this->get_tolerance() > this->tolerance) {return false;}
+                this->stopped_by = gd::stop_reason::tolerance;
+                return true;
+            }
+            returnType step_square{};
+            returnType gradient_square{};
+            for (std::size_t i = 0; i < this->dimension(); ++i) {
+                const returnType step = this->optimal_point[i] - this->old_optimal_point[i];
+                const returnType g = this->derivatives[i];
+                step_square += step * step;
+                const bool blocked = (this->old_optimal_point[i] <= this->lower_bounds[i] && g > 0) || (this->old_optimal_point[i] >= this->upper_bounds[i] && g < 0);
+                if (!blocked) {gradient_square += g * g;}
+            }
+            gd::iteration_summary<returnType> summary;
+            summary.value = this->optimal_val;
+            summary.previous_value = this->history.ago(0);
+            summary.step_length = std::sqrt(step_square);
+            summary.gradient_norm = std::sqrt(gradient_square);
+            summary.accepted = this->optimal_point != this->old_optimal_point;
+            this->history.push(this->optimal_val);
+            this->stopped_by = this->convergence_criteria_.check(summary, this->history);
+            return this->stopped_by != gd::stop_reason::none;
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_DYNAMIC_GRADIENT_DECENT_H
@@ -19,6 +19,7 @@ int main () {
   gradient_operator->add_upper_bounds(upper_bounds);
   gradient_operator->set_tolerance(1e-3);
 //        gradient_operator->toggle_classic_gradient_algo();  // uncomment this to use classic GD
+//        gradient_operator->set_learning_rate_policy(std::make_shared<gd::barzilai_borwein<double>>());  // uncomment this to keep the step scale between iterations
 
   auto start = std::chrono::high_resolution_clock::now();
   auto [minimum_value, minimum_point] = gradient_operator->perform_gradient_decent();
@@ -0,0 +1,261 @@
+/**
+ * @file flattened_arguments.h
+ * @brief Header file containing the flattening of array and struct arguments into contiguous coordinates.
+ *
+ * gd::gradient_decent treats every argument of the objective as one scalar coordinate, so an objective taking a
+ * std::array<double, 6> pose would have to be exploded into six template arguments (one instantiation of the whole
+ * solver per signature). gd::flattened_problem instead maps arithmetic, fixed-size array and struct arguments onto
+ * contiguous coordinates and solves them with the runtime-dimension optimiser (see dynamic_gradient_decent.h), so
+ * finite differences, stepping and bounds work per coordinate, and the objective still receives its own types.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_FLATTENED_ARGUMENTS_H
+#define CONCEPTUAL_FLATTENED_ARGUMENTS_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "dynamic_gradient_decent.h"
+
+namespace gd {
+    /**
+     * @brief Maps an argument type onto contiguous coordinates.
+     *
+     * Specialisations provide the number of coordinates `size`, and `flatten` / `unflatten` to copy a value to and
+     * from them. Arithmetic types, std::array of flattenable types and structs listing their members in a static
+     * `flat_members` tuple of member pointers are supported; other types may specialise flat_traits themselves.
+     *
+     * @tparam type The argument type.
+     *
+     * @code{.cpp}
+     * // example: a struct flattened through its members
+     * struct pose {
+     *     std::array<double, 3> position;
+     *     double yaw;
+     *     static constexpr auto flat_members = std::make_tuple(&pose::position, &pose::yaw);
+     * };
+     * static_assert(gd::flat_traits<pose>::size == 4);
+     * @endcode
+     */
+    template <class type>
+    struct flat_traits;
+
+    /**
+     * @brief True for structs that list their members in a static `flat_members` tuple of member pointers.
+     */
+    template <class type>
+    concept has_flat_members = requires {type::flat_members;};
+
+    /**
+     * @brief The value type of a member pointer.
+     */
+    template <class memberPointer>
+    struct member_pointee;
+
+    template <class valueType, class classType>
+    struct member_pointee<valueType classType::*> {
+        using type = valueType;
+    };
+
+    /**
+     * @brief Flattening of arithmetic types: one coordinate.
+     */
+    template <class type>
+    requires std::is_arithmetic_v<type>
+    struct flat_traits<type> {
+        static constexpr std::size_t size = 1;
+
+        template <class coordinateType>
+        static void flatten (const type &IN_VALUE, coordinateType *OUT_COORDINATES) noexcept {
+            *OUT_COORDINATES = static_cast<coordinateType>(IN_VALUE);
+        }
+
+        template <class coordinateType>
+        static void unflatten (const coordinateType *IN_COORDINATES, type &OUT_VALUE) noexcept {
+            OUT_VALUE = static_cast<type>(*IN_COORDINATES);
+        }
+    };
+
+    /**
+     * @brief Flattening of fixed-size arrays: the coordinates of the elements back to back.
+     */
+    template <class type, std::size_t N>
+    struct flat_traits<std::array<type, N>> {
+        static constexpr std::size_t size = N * flat_traits<type>::size;
+
+        template <class coordinateType>
+        static void flatten (const std::array<type, N> &IN_VALUE, coordinateType *OUT_COORDINATES) noexcept {
+            for (std::size_t i = 0; i < N; ++i) {flat_traits<type>::flatten(IN_VALUE[i], OUT_COORDINATES + i * flat_traits<type>::size);}
+        }
+
+        template <class coordinateType>
+        static void unflatten (const coordinateType *IN_COORDINATES, std::array<type, N> &OUT_VALUE) noexcept {
+            for (std::size_t i = 0; i < N; ++i) {flat_traits<type>::unflatten(IN_COORDINATES + i * flat_traits<type>::size, OUT_VALUE[i]);}
+        }
+    };
+
+    /**
+     * @brief Flattening of structs with `flat_members`: the coordinates of the listed members back to back.
+     *
+     * @note The struct must be default constructible to be unflattened.
+     */
+    template <class type>
+    requires has_flat_members<type>
+    struct flat_traits<type> {
+    private:
+        using members_type = std::remove_cvref_t<decltype(type::flat_members)>;
+
+        template <std::size_t i>
+        using member_type = typename member_pointee<std::tuple_element_t<i, members_type>>::type;
+
+        template <std::size_t... i>
+        static constexpr std::size_t size_of (std::index_sequence<i...>) noexcept {
+            return (std::size_t{0} + ... + flat_traits<member_type<i>>::size);
+        }
+
+        template <std::size_t i>
+        static constexpr std::size_t offset_of () noexcept {
+            return size_of(std::make_index_sequence<i>{});
+        }
+
+        using indices = std::make_index_sequence<std::tuple_size_v<members_type>>;
+
+    public:
+        static constexpr std::size_t size = size_of(indices{});
+
+        template <class coordinateType>
+        static void flatten (const type &IN_VALUE, coordinateType *OUT_COORDINATES) noexcept {
+            [&] <std::size_t... i> (std::index_sequence<i...>) {
+                (flat_traits<member_type<i>>::flatten(IN_VALUE.*std::get<i>(type::flat_members), OUT_COORDINATES + offset_of<i>()),...);
+            }(indices{});
+        }
+
+        template <class coordinateType>
+        static void unflatten (const coordinateType *IN_COORDINATES, type &OUT_VALUE) noexcept {
+            [&] <std::size_t... i> (std::index_sequence<i...>) {
+                (flat_traits<member_type<i>>::unflatten(IN_COORDINATES + offset_of<i>(), OUT_VALUE.*std::get<i>(type::flat_members)),...);
+            }(indices{});
+        }
+    };
+
+    /**
+     * @brief An optimisation problem over array and struct arguments, flattened into contiguous coordinates.
+     *
+     * The flattened_problem class converts between the objective's own argument types and the coordinates of the
+     * runtime-dimension optimiser, and creates an optimiser whose objective unflattens every point on the stack
+     * (without allocating) before calling the objective. Bounds, guesses and results are flattened and unflattened
+     * with the same layout.
+     *
+     * @tparam returnType The type of the objective function's return value and of the coordinates.
+     * @tparam argType The argument types of the objective function.
+     *
+     * @code{.cpp}
+     * // example: a 6-DOF pose and a ratio, 7 coordinates
+     * using problem = gd::flattened_problem<double, std::array<double, 6>, double>;
+     * auto solver = problem::make_solver(objective, initial_pose, 0.5);
+     * solver->add_lower_bounds(problem::flatten(lower_pose, 0.0));
+     * solver->add_upper_bounds(problem::flatten(upper_pose, 1.0));
+     * auto [minimum_value, minimum_point] = solver->perform_gradient_decent();
+     * auto [best_pose, best_ratio] = problem::unflatten(minimum_point);
+     * @endcode
+     */
+    template <class returnType, class... argType>
+    class flattened_problem {
+    public:
+        /**
+         * @brief The number of coordinates of the problem.
+         */
+        static constexpr std::size_t dimension = (std::size_t{0} + ... + flat_traits<argType>::size);
+
+        using point_type = typename gd::dynamic_gradient_decent<returnType>::point_type;
+        using function_type = typename gd::dynamic_gradient_decent<returnType>::function_type;
+
+        /**
+         * @brief Flattens arguments into coordinates.
+         *
+         * @param IN_ARGS The arguments.
+         * @return The coordinates, dimension of them.
+         */
+        [[nodiscard]] static point_type flatten (const argType &... IN_ARGS) {
+            point_type coordinates(dimension);
+            flattened_problem::flatten(std::forward_as_tuple(IN_ARGS...), coordinates);
+            return coordinates;
+        }
+
+        /**
+         * @brief Flattens a tuple of arguments into caller-provided coordinates.
+         *
+         * @param IN_ARGS The arguments.
+         * @param OUT_COORDINATES The coordinates; must hold dimension values.
+         */
+        static void flatten (const std::tuple<const argType &...> &IN_ARGS, std::span<returnType> OUT_COORDINATES) noexcept {
+            [&] <std::size_t... i> (std::index_sequence<i...>) {
+                (flat_traits<argType>::flatten(std::get<i>(IN_ARGS), OUT_COORDINATES.data() + offset_of<i>()),...);
+            }(std::index_sequence_for<argType...>{});
+        }
+
+        /**
+         * @brief Unflattens coordinates into arguments.
+         *
+         * @param IN_COORDINATES The coordinates, dimension of them.
+         * @return The arguments.
+         */
+        [[nodiscard]] static std::tuple<argType...> unflatten (std::span<const returnType> IN_COORDINATES) noexcept {
+            std::tuple<argType...> args {};
+            [&] <std::size_t... i> (std::index_sequence<i...>) {
+                (flat_traits<argType>::unflatten(IN_COORDINATES.data() + offset_of<i>(), std::get<i>(args)),...);
+            }(std::index_sequence_for<argType...>{});
+            return args;
+        }
+
+        /**
+         * @brief Wraps an objective over the argument types into an objective over the coordinates.
+         *
+         * @param IN_FUNC The objective function, callable as returnType(argType...).
+         */
+        template <class funcType>
+        requires std::is_invocable_r_v<returnType, funcType, argType...>
+        [[nodiscard]] static function_type make_objective (funcType &&IN_FUNC) {
+            return [func = std::forward<funcType>(IN_FUNC)] (std::span<const returnType> IN_COORDINATES) -> returnType {
+                return std::apply(func, flattened_problem::unflatten(IN_COORDINATES));
+            };
+        }
+
+        /**
+         * @brief Creates a runtime-dimension optimiser for an objective over the argument types.
+         *
+         * @param IN_FUNC The objective function, callable as returnType(argType...).
+         * @param IN_GUESS The initial guess.
+         * @return The configured optimiser; its points are flattened (see unflatten()).
+         *
+         * @note The optimiser has no constraints, caches or asynchronous evaluation (see gd::dynamic_gradient_decent).
+         */
+        template <class funcType>
+        requires std::is_invocable_r_v<returnType, funcType, argType...>
+        [[nodiscard]] static std::unique_ptr<gd::dynamic_gradient_decent<returnType>> make_solver (funcType &&IN_FUNC, const argType &... IN_GUESS) {
+            return std::make_unique<gd::dynamic_gradient_decent<returnType>>(
+                    flattened_problem::make_objective(std::forward<funcType>(IN_FUNC)), flattened_problem::flatten(IN_GUESS...));
+        }
+
+    private:
+        template <std::size_t i>
+        static constexpr std::size_t offset_of () noexcept {
+            return [] <std::size_t... j> (std::index_sequence<j...>) {
+                return (std::size_t{0} + ... + flat_traits<std::tuple_element_t<j, std::tuple<argType...>>>::size);
+            }(std::make_index_sequence<i>{});
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_FLATTENED_ARGUMENTS_H
@@ -23,8 +23,11 @@
  * - When VERBOSITY is enabled (VERBOSITY = 1), debug messages are printed to the standard output stream.
  * - When VERBOSITY is disabled (VERBOSITY = 0), the macros expand to empty statements, avoiding any overhead
  *   in production code.
+ * - VERBOSITY may be defined before including this header (e.g. by a long-running service) to override the default.
  */
+#ifndef VERBOSITY
 #define VERBOSITY 1
+#endif
 
 #if VERBOSITY
 #define VERBOSE_PRINT(x)  do { \
@@ -47,16 +50,33 @@
 #define _VERBOSE_PRINT_(x)
 #endif
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <deque>
 #include <functional>
+#include <future>
 #include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
 #include <tuple>
+#include <typeinfo>
 #include <utility>
+#include <vector>
 
 
+#include "convergence_criteria.h"
+#include "learning_rate_policy.h"
 #include "mathematical_constraint.h"
 #include "meta_types.h"
+#include "result_cache.h"
+#include "shared_eval_cache.h"
+#include "work_stealing_scheduler.h"
 
 /**
  * @brief Namespace for gradient descent optimisation utilities.
@@ -65,6 +85,33 @@
  * It provides functionality for wrapping objective functions and performing gradient descent optimisation.
  */
 namespace gd {
+    /**
+     * @brief Tag selecting objectives of the form f(const paramsType&, args...) (see gd::with_parameters).
+     *
+     * @tparam paramsType The type of the per-problem parameters.
+     */
+    template <class paramsType>
+    struct parameters_tag {
+        explicit parameters_tag () = default;
+    };
+
+    /**
+     * @brief Tag value selecting objectives of the form f(const paramsType&, args...).
+     *
+     * The parameters are not optimisation variables: they are bound by reference per solve (see
+     * gradient_decent::make_workspace()) and excluded from differentiation and stepping, so one stateless objective
+     * serves any number of problem instances without capturing their data.
+     *
+     * @code{.cpp}
+     * // example
+     * struct fit_data {double a; double b;};
+     * auto objective = [] (const fit_data &data, double x, double y) {return (x - data.a) * (x - data.a) + (y - data.b) * (y - data.b);};
+     * gd::gradient_decent<double, double, double> gradient_operator(gd::with_parameters<fit_data>, objective, 1.6, -1.2);
+     * @endcode
+     */
+    template <class paramsType>
+    inline constexpr parameters_tag<paramsType> with_parameters {};
+
     /**
      * @brief Wrapper for an objective function.
      *
@@ -72,6 +119,13 @@ namespace gd {
      * with specified return type and argument types with special checks and safety guards.
      * It allows evaluation of the objective function at different argument values.
      *
+     * The objective function may also be asynchronous, returning a std::future of the value (e.g. a remote service
+     * or a local stand-in for one). eval_func_async() then issues an evaluation without waiting for it, and
+     * eval_func_at() waits for the value.
+     *
+     * The objective function may also take per-problem parameters before its arguments (see gd::with_parameters).
+     * The parameters are passed type-erased to eval_func_at() and eval_func_async().
+     *
      * @tparam returnType The return type of the objective function.
      * @tparam argType The argument types of the objective function.
      * */
@@ -94,6 +148,72 @@ namespace gd {
         requires (meta_types::check_func_v<returnType, funcType, argType...>)
         explicit function_wrapper (funcType &&IN_FUNC) : function (std::forward<funcType>(IN_FUNC)) {}
 
+        /**
+         * @brief Constructor for the function wrapper of an asynchronous objective function.
+         *
+         * @tparam funcType The type of the objective function, returning std::future<returnType>.
+         * @param IN_FUNC The objective function to be wrapped.
+         */
+        template<class funcType>
+        requires (meta_types::check_async_func_v<returnType, funcType, argType...> && !meta_types::check_func_v<returnType, funcType, argType...>)
+        explicit function_wrapper (funcType &&IN_FUNC) : async_function (std::forward<funcType>(IN_FUNC)) {}
+
+        /**
+         * @brief Constructor for the function wrapper of an objective function taking parameters.
+         *
+         * A stateless objective (e.g. a lambda without captures) is stored without allocating.
+         *
+         * @tparam paramsType The type of the parameters.
+         * @tparam funcType The type of the objective function, callable as returnType(const paramsType&, argType...).
+         * @param IN_FUNC The objective function to be wrapped.
+         */
+        template<class paramsType, class funcType>
+        requires (std::is_invocable_r_v<returnType, funcType&, const paramsType&, argType...>)
+        function_wrapper (parameters_tag<paramsType>, funcType &&IN_FUNC) :
+                parameters_function ([func = std::forward<funcType>(IN_FUNC)] (const void *IN_PARAMETERS, argType... IN_ARGS) -> returnType {
+                    return func(*static_cast<const paramsType*>(IN_PARAMETERS), IN_ARGS...);
+                }),
+                parameters_type (&typeid(paramsType)) {}
+
+        /**
+         * @brief Returns true if the wrapped objective function takes parameters.
+         */
+        [[nodiscard]] bool takes_parameters () const noexcept {
+            return this->parameters_type != nullptr;
+        }
+
+        /**
+         * @brief Returns true if the wrapped objective function takes parameters of the given type.
+         */
+        template<class paramsType>
+        [[nodiscard]] bool takes_parameters_of () const noexcept {
+            return this->parameters_type != nullptr && *this->parameters_type == typeid(paramsType);
+        }
+
+        /**
+         * @brief Returns true if the wrapped objective function returns futures.
+         */
+        [[nodiscard]] bool is_async () const noexcept {
+            return static_cast<bool>(this->async_function);
+        }
+
+        /**
+         * @brief Issues an evaluation of the objective function without waiting for its value.
+         *
+         * @tparam tupleType The type of the tuple containing arguments.
+         * @param IN_ARGS The tuple containing arguments at which the function is evaluated.
+         * @param IN_PARAMETERS The parameters, if the objective function takes them.
+         * @return The future value; already ready if the objective function is synchronous.
+         */
+        template<class tupleType>
+        requires (std::is_same_v<meta_types::remove_all_qual<tupleType>, std::tuple<argType...>>)
+        [[nodiscard]] std::future<returnType> eval_func_async (tupleType &&IN_ARGS, const void *IN_PARAMETERS = nullptr) const {
+            if (this->async_function) {return std::apply(this->async_function, std::forward<tupleType>(IN_ARGS));}
+            std::promise<returnType> ready;
+            ready.set_value(this->eval_func_at(std::forward<tupleType>(IN_ARGS), IN_PARAMETERS));
+            return ready.get_future();
+        }
+
         /**
          * @brief Evaluates the objective function at the specified arguments.
          *
@@ -101,6 +221,7 @@ namespace gd {
          *
          * @tparam tupleType The type of the tuple containing arguments.
          * @param IN_ARGS The tuple containing arguments at which the function is evaluated.
+         * @param IN_PARAMETERS The parameters, if the objective function takes them.
          * @return The result of evaluating the objective function at the specified arguments.
          *
          * @details
@@ -112,7 +233,11 @@ namespace gd {
          */
         template<class tupleType>
         requires (std::is_same_v<meta_types::remove_all_qual<tupleType>, std::tuple<argType...>>)
-        [[nodiscard]] returnType eval_func_at (tupleType &&IN_ARGS) const noexcept {
+        [[nodiscard]] returnType eval_func_at (tupleType &&IN_ARGS, const void *IN_PARAMETERS = nullptr) const noexcept {
+            if (this->async_function) {return std::apply(this->async_function, std::forward<tupleType>(IN_ARGS)).get();}
+            if (this->parameters_function) {
+                return std::apply([this, IN_PARAMETERS] (const argType &... IN_VALUES) {return this->parameters_function(IN_PARAMETERS, IN_VALUES...);}, IN_ARGS);
+            }
             return std::apply(this->function, std::forward<tupleType>(IN_ARGS));
         };
 
@@ -139,9 +264,172 @@ namespace gd {
         }
     private:
         std::function<returnType(argType...)> function; ///< The objective function to be wrapped.
+        std::function<std::future<returnType>(argType...)> async_function; ///< The asynchronous objective function, if any.
+        std::function<returnType(const void*, argType...)> parameters_function; ///< The objective function taking parameters, if any.
+        const std::type_info *parameters_type = nullptr; ///< The type of the parameters, if the objective function takes them.
+    };
+
+
+    /**
+     * @brief How gradient_decent normalises the optimisation variables (see gradient_decent::set_variable_scaling()).
+     */
+    enum class variable_scaling : std::uint8_t {
+        none,       ///< Steps along the raw gradient.
+        bounds,     ///< Each variable is measured in units of its bound range.
+        curvature   ///< Each variable is measured in units of its estimated inverse diagonal curvature.
     };
 
 
+    /**
+     * @brief Mutable run state of one gradient descent solve.
+     *
+     * The solver_workspace struct holds everything that changes while gradient_decent iterates: the current and
+     * previous optimal points, the optimal value, the learning rate, the derivatives and step scales, and the
+     * function call count. Keeping this state out of the optimiser lets one configured (const) optimiser serve
+     * many concurrent solves, each with its own workspace (see gradient_decent::solve()).
+     *
+     * @tparam returnType The type of the objective function's return value.
+     * @tparam argType The types of the optimisation variables.
+     *
+     * @note A workspace may be reused for any number of solves; reset it with gradient_decent::reset_workspace().
+     */
+    template <class returnType, class... argType>
+    struct solver_workspace {
+        /**
+         * @brief Tuple representing the optimal point.
+         */
+        std::tuple<argType...> optimal_point {};
+        /**
+         * @brief Tuple representing the old optimal point.
+         */
+        std::tuple<argType...> old_optimal_point {};
+        /**
+         * @brief Value of the objective function at the optimal point.
+         */
+        returnType optimal_val {};
+        /**
+         * @brief Current tolerance value (default: 0.002F).
+         */
+        returnType current_tolerance = 0.002F;
+        /**
+         * @brief Learning rate for gradient descent optimization.
+         */
+        returnType learning_rate = 1.0;
+        /**
+         * @brief Array of step scales for optimization variables.
+         */
+        std::array<returnType, sizeof...(argType)> step_scales {};
+        /**
+         * @brief Tuple representing the derivatives of the objective function.
+         */
+        std::tuple<argType...> derivatives {};
+        /**
+         * @brief Tuple representing the high values of the derivatives.
+         */
+        std::tuple<argType...> derivative_high {};
+        /**
+         * @brief Flag indicating if it's the first iteration settings.
+         */
+        bool first_iteration_settings = true;
+        /**
+         * @brief Flag indicating if the last optimisation was stopped by the iteration callback.
+         */
+        bool stopped_by_callback = false;
+        /**
+         * @brief The parameters bound to the solve, if the objective function takes them (see gd::with_parameters).
+         */
+        const void *parameters = nullptr;
+        /**
+         * @brief The stopping test that ended the last solve.
+         */
+        gd::stop_reason stopped_by = gd::stop_reason::none;
+        /**
+         * @brief The recent optimal values of the solve, used by the stall test of the convergence criteria.
+         */
+        gd::convergence_history<returnType> history;
+        /**
+         * @brief Number of times the objective function is called.
+         */
+        std::size_t func_call_count = 0;
+        /**
+         * @brief Per-constraint penalties at the base point of the last finite difference stencil.
+         */
+        std::vector<returnType> constraint_penalties;
+        /**
+         * @brief The point the constraint penalties were evaluated at.
+         */
+        std::tuple<argType...> constraint_penalties_point {};
+        /**
+         * @brief Objective values of the speculative finite difference stencil, one per variable.
+         */
+        std::array<returnType, sizeof...(argType)> speculative_values {};
+        /**
+         * @brief The base point of the speculative finite difference stencil.
+         */
+        std::tuple<argType...> speculative_point {};
+        /**
+         * @brief Flag indicating if the speculative stencil holds the values for the next derivatives.
+         */
+        bool speculative_valid = false;
+        /**
+         * @brief Diagonal preconditioner applied to every step, one factor per variable (1 without variable scaling).
+         */
+        std::array<returnType, sizeof...(argType)> preconditioner {};
+        /**
+         * @brief Estimated inverse diagonal curvature per variable; 0 where no estimate is available yet.
+         */
+        std::array<returnType, sizeof...(argType)> inverse_curvature {};
+        /**
+         * @brief The point of the previous derivatives, for the curvature estimate and the learning rate policy.
+         */
+        std::tuple<argType...> previous_point {};
+        /**
+         * @brief The derivatives of the previous iteration, for the curvature estimate and the learning rate policy.
+         */
+        std::tuple<argType...> previous_derivatives {};
+        /**
+         * @brief Flag indicating if the previous derivatives are set.
+         */
+        bool previous_derivatives_valid = false;
+        /**
+         * @brief Residuals of the constraints being projected onto (see gradient_decent::toggle_equality_projection()
+         * and gradient_decent::toggle_feasibility_restoration()).
+         */
+        std::vector<returnType> constraint_residuals;
+        /**
+         * @brief Residuals of the constraints being projected onto at a finite difference point.
+         */
+        std::vector<returnType> constraint_probe;
+        /**
+         * @brief Tolerances of the equality constraints being projected onto.
+         */
+        std::vector<returnType> constraint_tolerances;
+        /**
+         * @brief Residuals of every constraint during feasibility restoration.
+         */
+        std::vector<returnType> constraint_values;
+        /**
+         * @brief The constraints being projected onto during feasibility restoration.
+         */
+        std::vector<std::size_t> constraint_rows;
+        /**
+         * @brief Jacobian of the residuals, row-major with one row per constraint being projected onto.
+         */
+        std::vector<returnType> constraint_jacobian;
+        /**
+         * @brief The normal matrix J P J^T of the projection, row-major.
+         */
+        std::vector<returnType> constraint_system;
+        /**
+         * @brief Right-hand side, then solution, of the projection's normal equations.
+         */
+        std::vector<returnType> constraint_multipliers;
+        /**
+         * @brief Evaluations of trial points issued past the accepted one, kept until they finish so their
+         * destructors (which block for std::async futures) do not hold up the step that accepted a point.
+         */
+        std::vector<std::future<returnType>> abandoned_evaluations;
+    };
 
 
     /**
@@ -165,6 +453,11 @@ namespace gd {
      * Additionally, momentum rotation of derivatives and derivative based scaling can be employed
      * as needed.
      *
+     * The configuration of the problem (objective function, bounds, constraints and settings) is kept apart from
+     * the run state (gd::solver_workspace). perform_gradient_decent() solves with a workspace owned by the
+     * optimiser, while the const solve() API runs on a caller-provided workspace, so one configured optimiser can
+     * serve many threads at once, each with its own workspace.
+     *
      * @note Ensure that the objective function and optimisation variables are compatible
      * with the specified types. Experiment with different optimisation parameters
      * and algorithms to achieve optimal convergence and performance.
@@ -172,6 +465,10 @@ namespace gd {
     template <class returnType, class... argType>
     class gradient_decent {
     public:
+        /**
+         * @brief The run state type used by solve().
+         */
+        using workspace = gd::solver_workspace<returnType, argType...>;
 
         /**
          * @brief Default constructor for gradient descent.
@@ -203,22 +500,60 @@ namespace gd {
          * at the initial guess point to obtain the initial value, and sets default values for learning rate (1.0),
          * finite difference step (0.001), and step scales (1.0).
          *
+         * The objective function may return std::future<returnType> instead of a value. The finite difference stencil
+         * and the back-tracking line search then keep several evaluations in flight (see set_max_in_flight()).
+         *
          * @note Ensure that the objective function and initial guess are compatible with the specified types.
          * Experiment with different initial guesses and optimisation parameters to achieve optimal convergence.
          */
         template<class funcType_, class... argType_>
-        requires(meta_types::are_same<argType_..., argType...>::value && meta_types::check_func_v<returnType, funcType_, argType_...>)
+        requires(meta_types::are_same<argType_..., argType...>::value && (meta_types::check_func_v<returnType, funcType_, argType_...> || meta_types::check_async_func_v<returnType, funcType_, argType_...>))
         explicit gradient_decent (funcType_ &&IN_FUNC, argType_ &&... IN_GUESS) {
             this->function = std::make_unique<gd::function_wrapper<returnType, argType...>>(
                     std::forward<funcType_>(IN_FUNC));
-            this->optimal_point = std::make_tuple(std::forward<argType_>(IN_GUESS)...);
-            this->optimal_val = this->eval_func_at(this->optimal_point);
-            this->learning_rate = 1.0;
+            this->initial_guess = std::make_tuple(std::forward<argType_>(IN_GUESS)...);
             this->finite_difference_step = 0.001;
-            this->step_scales.fill(1.0);
+            this->reset_workspace(this->state);
             VERBOSE_PRINT("Gradient Decent instance created...");
         }
 
+        /**
+         * @brief Constructor for the gradient descent optimiser of an objective function taking parameters.
+         *
+         * The objective function is called as IN_FUNC(parameters, args...), where the parameters are bound by
+         * reference per solve (see make_workspace() and perform_gradient_decent()) and are neither differentiated
+         * nor stepped. One optimiser then serves any number of problem instances without capturing their data.
+         *
+         * @tparam paramsType The type of the parameters.
+         * @tparam funcType_ The type of the objective function.
+         * @tparam argType_ The types of the optimisation variables.
+         * @param IN_FUNC The objective function to be minimised.
+         * @param IN_GUESS The initial guess for the optimisation variables.
+         *
+         * @code{.cpp}
+         * // example: one optimiser, one workspace per problem instance
+         * gd::gradient_decent<double, double, double> gradient_operator(gd::with_parameters<fit_data>, objective, 1.6, -1.2);
+         * for (const fit_data &data : instances) {
+         *     auto ws = gradient_operator.make_workspace(data, std::make_tuple(1.6, -1.2));
+         *     auto [minimum_value, minimum_point] = gradient_operator.solve(ws);
+         * }
+         * @endcode
+         *
+         * @note The objective function is not evaluated at the initial guess until parameters are bound.
+         * The shared evaluation cache and the result cache are bypassed for solves with bound parameters, since
+         * their keys do not include the parameters.
+         */
+        template<class paramsType, class funcType_, class... argType_>
+        requires(meta_types::are_same<argType_..., argType...>::value && std::is_invocable_r_v<returnType, funcType_&, const paramsType&, argType...>)
+        gradient_decent (gd::parameters_tag<paramsType> IN_TAG, funcType_ &&IN_FUNC, argType_ &&... IN_GUESS) {
+            this->function = std::make_unique<gd::function_wrapper<returnType, argType...>>(
+                    IN_TAG, std::forward<funcType_>(IN_FUNC));
+            this->initial_guess = std::make_tuple(std::forward<argType_>(IN_GUESS)...);
+            this->finite_difference_step = 0.001;
+            this->reset_workspace(this->state);
+            VERBOSE_PRINT("Gradient Decent instance created with parameters...");
+        }
+
         /**
          * @brief Virtual destructor for gradient descent.
          * The virtual destructor for the gradient descent class is declared as default.
@@ -409,7 +744,151 @@ namespace gd {
         template<class type>
         requires (std::is_same_v<meta_types::remove_all_qual<type>, returnType>)
         void set_initial_learning_rate (type &&IN_RATE) noexcept {
-            this->learning_rate = std::forward<type>(IN_RATE);
+            this->initial_learning_rate = std::forward<type>(IN_RATE);
+            this->state.learning_rate = this->initial_learning_rate;
+        }
+
+        /**
+         * @brief Changes the initial guess and resets the run state of the optimiser.
+         *
+         * This method replaces the current point with a new initial guess, evaluates the objective function at it and
+         * resets the state carried between iterations (learning rate, highest derivatives, current tolerance and
+         * function call count). The configuration of the optimiser (objective function, bounds, constraints,
+         * tolerance and toggles) is kept, so one configured optimiser can be reused for many solves.
+         *
+         * @tparam tupleType The type of the tuple containing the new initial guess.
+         * @param IN_GUESS The tuple containing the new initial guess.
+         *
+         * @note The new initial guess must lie within the bounds of the optimisation variables.
+         */
+        template<class tupleType>
+        requires(meta_types::are_tuples_same_v<tupleType, std::tuple<argType...>>)
+        void change_initial_guess (tupleType &&IN_GUESS) {
+            this->initial_guess = std::forward<tupleType>(IN_GUESS);
+            this->reset_workspace(this->state);
+        }
+
+        /**
+         * @brief Changes the initial guess and resets the run state of the optimiser (overload).
+         *
+         * This is an overload to allow a convenient way to input as variadic arguments.
+         *
+         * @tparam argType_ The types of the new initial guess for each optimisation variable.
+         * @param IN_GUESS The new initial guess for each optimisation variable as individual arguments.
+         */
+        template<class... argType_>
+        requires(meta_types::are_same<argType_..., argType...>::value)
+        void change_initial_guess (argType_ &&... IN_GUESS) {
+            this->change_initial_guess(std::make_tuple(std::forward<argType_>(IN_GUESS)...));
+        }
+
+        /**
+         * @brief Returns the number of times the objective function was called since the last (re)start.
+         */
+        [[nodiscard]] std::size_t get_func_call_count () const noexcept {
+            return this->state.func_call_count;
+        }
+
+        /**
+         * @brief Creates a workspace seeded with the configured initial guess.
+         *
+         * @return A workspace ready for solve().
+         *
+         * @note Evaluates the objective function once, at the initial guess.
+         */
+        [[nodiscard]] workspace make_workspace () const {
+            workspace ws;
+            this->reset_workspace(ws);
+            return ws;
+        }
+
+        /**
+         * @brief Creates a workspace seeded with the given initial guess.
+         *
+         * @param IN_GUESS The initial guess of this solve.
+         * @return A workspace ready for solve().
+         */
+        [[nodiscard]] workspace make_workspace (const std::tuple<argType...> &IN_GUESS) const {
+            workspace ws;
+            this->reset_workspace(ws, IN_GUESS);
+            return ws;
+        }
+
+        /**
+         * @brief Creates a workspace with bound parameters, seeded with the given initial guess.
+         *
+         * @param IN_PARAMETERS The parameters of this solve; referenced, so they must outlive the workspace's solves.
+         * @param IN_GUESS The initial guess of this solve.
+         * @return A workspace ready for solve().
+         */
+        template<class paramsType>
+        [[nodiscard]] workspace make_workspace (const paramsType &IN_PARAMETERS, const std::tuple<argType...> &IN_GUESS) const {
+            workspace ws;
+            this->reset_workspace(ws, IN_PARAMETERS, IN_GUESS);
+            return ws;
+        }
+
+        /**
+         * @brief Resets a workspace to the configured initial guess.
+         *
+         * @param IN_WORKSPACE The workspace to reset.
+         */
+        void reset_workspace (workspace &IN_WORKSPACE) const {
+            this->reset_workspace(IN_WORKSPACE, this->initial_guess);
+        }
+
+        /**
+         * @brief Resets a workspace to the given initial guess.
+         *
+         * This method resets every member of the workspace (learning rate, derivatives, step scales, current tolerance
+         * and function call count) and evaluates the objective function at the initial guess, without allocating.
+         *
+         * @param IN_WORKSPACE The workspace to reset.
+         * @param IN_GUESS The initial guess of the next solve.
+         *
+         * @note The parameters bound to the workspace, if any, are kept.
+         */
+        void reset_workspace (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_GUESS) const {
+            IN_WORKSPACE.optimal_point = IN_GUESS;
+            IN_WORKSPACE.old_optimal_point = IN_GUESS;
+            IN_WORKSPACE.learning_rate = this->initial_learning_rate;
+            IN_WORKSPACE.current_tolerance = 0.002F;
+            IN_WORKSPACE.step_scales.fill(1.0);
+            IN_WORKSPACE.derivatives = {};
+            IN_WORKSPACE.derivative_high = {};
+            IN_WORKSPACE.first_iteration_settings = true;
+            IN_WORKSPACE.stopped_by_callback = false;
+            IN_WORKSPACE.stopped_by = gd::stop_reason::none;
+            IN_WORKSPACE.func_call_count = 0;
+            IN_WORKSPACE.constraint_penalties.clear();
+            IN_WORKSPACE.speculative_valid = false;
+            IN_WORKSPACE.preconditioner.fill(1.0);
+            IN_WORKSPACE.inverse_curvature.fill(0.0);
+            IN_WORKSPACE.previous_derivatives_valid = false;
+            if (this->function->takes_parameters() && IN_WORKSPACE.parameters == nullptr) {
+                IN_WORKSPACE.optimal_val = std::numeric_limits<returnType>::quiet_NaN();
+                return;
+            }
+            IN_WORKSPACE.optimal_val = this->eval_func_at(IN_WORKSPACE, IN_WORKSPACE.optimal_point);
+        }
+
+        /**
+         * @brief Binds parameters to a workspace and resets it to the given initial guess.
+         *
+         * @param IN_WORKSPACE The workspace to reset.
+         * @param IN_PARAMETERS The parameters of the next solve; referenced, so they must outlive its solves.
+         * @param IN_GUESS The initial guess of the next solve.
+         *
+         * @note A runtime_error is thrown if the objective function does not take parameters of this type.
+         */
+        template<class paramsType>
+        void reset_workspace (workspace &IN_WORKSPACE, const paramsType &IN_PARAMETERS, const std::tuple<argType...> &IN_GUESS) const {
+            if (!this->function->template takes_parameters_of<paramsType>()) {
+                std::cerr << "The objective function does not take parameters of this type" << std::endl;
+                throw std::runtime_error("The objective function does not take parameters of this type");
+            }
+            IN_WORKSPACE.parameters = std::addressof(IN_PARAMETERS);
+            this->reset_workspace(IN_WORKSPACE, IN_GUESS);
         }
 
         /**
@@ -487,81 +966,649 @@ namespace gd {
          * - `value`: The value associated with the constraint.
          * - `operator_`: The operator used in the constraint.
          * - `tolerance`: The tolerance value for the constraint.
+         * - `cost`: The relative evaluation cost of the constraint function.
+         * - `dependencies`: The indices of the variables the constraint function reads (empty for every variable).
          *
          * @code{.cpp}
          * //example
          * auto constraint1_ = aux::constraints_system<returnType, argsType...>::create_constraint<decltype(constraint_function_1), double>(constraint_function_1, "&#x3C;", 9.0, 0.001f);
+         * constraint1_.dependencies = {0, 2};     // reads the first and third variable only
          * @endcode
          *
-         * @note Constraints must be added before performing the optimisation.
+         * @note Constraints must be added before performing the optimisation. The run state is reset, so the value at
+         * the initial guess includes the constraint penalty; workspaces made before are not updated.
          * The method assumes that the provided constraint objects have member variables:
          * `func`, `value`, `operator_`, and `tolerance`.
          * */
         template <template <class, class> class... createConstraintType, class constraintFuncType, typename valueType>
-        void add_constraints(createConstraintType<constraintFuncType, valueType>&... constraints) noexcept {
+        void add_constraints(createConstraintType<constraintFuncType, valueType>&... constraints) {
             this->constraints_on = true;
             this->constraint_manager_ = std::make_unique<typename aux::constraints_system<returnType, argType...>::template constraint_manager<decltype(constraints.func)...>>(std::move(constraints.func)..., (constraints.value)...);
             this->constraint_manager_->add_operators(std::vector<std::string>{constraints.operator_...});
             this->constraint_manager_->add_tolerances(std::vector<float>{constraints.tolerance...});
+            this->constraint_manager_->add_costs(std::vector<float>{constraints.cost...});
+            this->constraint_manager_->add_dependencies(std::vector<std::vector<std::size_t>>{constraints.dependencies...});
+            this->constraint_manager_->equalities_projected = this->use_equality_projection;
             VERBOSE_PRINT("Constraints ON");
-            VERBOSE_PRINT("Added " << this->constraint_manager_.constraint_count << " constraints...");
+            VERBOSE_PRINT("Added " << sizeof...(constraints) << " constraints...");
+            this->reset_workspace(this->state);
         }
 
         /**
-         * @brief Performs gradient descent optimization.
+         * @brief Replaces the objective function with a joint objective and constraint function.
          *
-         * This method performs gradient descent optimisation to find the optimal point
-         * for the given function. It iteratively updates the current point, function value
-         * until convergence and derivatives until convergence or until the maximum number
-         * of iterations is reached.
+         * The joint function is called once per point and returns the objective value together with every
+         * constraint value (see aux::constraints_system::joint_evaluator), so an objective and constraints that
+         * come out of one expensive evaluation no longer run it once for the objective and once per constraint.
          *
-         * @tparam returnType The return type of the objective function.
-         * @tparam argType    The argument types of the objective function.
-         * @return A pair containing the optimal value and the optimal point.
+         * @param IN_FUNC The joint function: `returnType(argType..., std::span<returnType> OUT_CONSTRAINTS)`.
+         * @param IN_OPERATORS The operator of every constraint.
+         * @param IN_VALUES The value every constraint is evaluated against.
+         * @param IN_TOLERANCES The tolerance of every constraint.
          *
-         * @details The method initializes an evaluation counter and enters a do-while loop to perform
-         * gradient descent iterations. Within each iteration:
-         * <ul>
-         * <li> The old optimal point is updated.
-         * <li> The iteration details are printed if verbosity is enabled.
-         * <li> Step scales are reset to 1.0.
-         * <li> Derivatives are calculated at the optimal point.
-         * <li> Either classic gradient descent with backtracking or step forward algorithm with secant method scaling
-         * is applied.
-         * </ul>
-         * The loop continues until the evaluation counter exceeds the maximum evaluation count
-         * or the tolerance condition is met.
+         * @code{.cpp}
+         * // example
+         * solver.set_joint_evaluator([] (double x, double y, std::span<double> OUT_CONSTRAINTS) {
+         *     auto result = run_simulation(x, y);
+         *     OUT_CONSTRAINTS[0] = result.stress;
+         *     return result.drag;
+         * }, {"&#x3C;"}, {250.0}, {0.001f});
+         * @endcode
          *
-         * If gradient descent fails to converge within the specified maximum evaluation count
-         * and tolerance, a runtime error is thrown.
+         * @note The objective function given to the constructor is no longer called. Constraints added with
+         * add_constraints() are still applied on top. The shared evaluation cache is not consulted for joint
+         * evaluations. A runtime_error is thrown if the operators, values and tolerances differ in length. The run
+         * state is reset, so the value at the initial guess comes from the joint function.
+         */
+        template <class funcType>
+        void set_joint_evaluator (funcType &&IN_FUNC, std::vector<std::string> IN_OPERATORS, std::vector<returnType> IN_VALUES, std::vector<float> IN_TOLERANCES) {
+            this->joint_evaluator_ = std::make_unique<typename aux::constraints_system<returnType, argType...>::joint_evaluator>(std::forward<funcType>(IN_FUNC), std::move(IN_OPERATORS), std::move(IN_VALUES), std::move(IN_TOLERANCES));
+            VERBOSE_PRINT("Joint evaluator ON");
+            VERBOSE_PRINT("Added " << this->joint_evaluator_->constraint_count() << " joint constraints...");
+            this->reset_workspace(this->state);
+        }
+
+        /**
+         * @brief Attaches a persistent result cache to the optimiser.
          *
-         * After convergence, the optimal point and value are printed if verbosity is enabled.
+         * This method attaches a result cache (see gd::result_cache) to the optimiser. Before solving, the problem
+         * description is hashed into a fingerprint; if the cache already holds a result for that fingerprint,
+         * perform_gradient_decent() returns it immediately without evaluating the objective function.
+         * Otherwise, the result of the solve is stored in the cache.
          *
-         * @note The algorithm uses classic gradient descent with backtracking or step forward algorithm with secant
-         * method scaling based on the `use_classic_gd` flag.
+         * @param IN_CACHE The result cache, possibly shared between several optimisers.
+         * @param IN_OBJECTIVE_ID A stable identifier of the objective function.
+         * @param IN_PARAMETERS Serialised parameters of the objective function, if any (default: empty).
+         *
+         * @details
+         * The fingerprint covers the objective identifier, the parameters, the lower and upper bounds, the initial
+         * guess, the initial learning rate, the finite difference step, the tolerance, the maximum evaluation
+         * count and the algorithm toggles.
+         *
+         * @note The objective function and constraints themselves cannot be hashed; the caller must make sure that
+         * the identifier and parameters change whenever the objective or the constraints change.
          */
-        std::pair<returnType, std::tuple<argType...>> perform_gradient_decent () {
-            std::size_t eval = 0;
+        void set_result_cache (std::shared_ptr<gd::result_cache<returnType, argType...>> IN_CACHE, std::string IN_OBJECTIVE_ID, std::string IN_PARAMETERS = {}) noexcept {
+            this->result_cache_ = std::move(IN_CACHE);
+            this->objective_id = std::move(IN_OBJECTIVE_ID);
+            this->objective_parameters = std::move(IN_PARAMETERS);
+            VERBOSE_PRINT("Result cache attached for objective " << this->objective_id);
+        }
+
+        /**
+         * @brief Attaches a cross-process shared evaluation cache to the optimiser.
+         *
+         * Every evaluation of the objective function first consults the cache (see gd::shared_eval_cache) and only
+         * calls the objective function on a miss; the value is then published for every other optimiser (in this or
+         * another process) that shares the cache file. Constraint penalties are always evaluated.
+         *
+         * @param IN_CACHE The shared evaluation cache.
+         *
+         * @note Choose the quantum of the cache well below the finite difference step.
+         */
+        void set_eval_cache (std::shared_ptr<gd::shared_eval_cache<returnType, argType...>> IN_CACHE) noexcept {
+            this->eval_cache_ = std::move(IN_CACHE);
+            VERBOSE_PRINT("Shared evaluation cache attached");
+        }
+
+        /**
+         * @brief Sets the scheduler used by every parallel path of the optimiser.
+         *
+         * Parallel finite differences (see toggle_parallel_derivatives()) and solve_multi_start() run their tasks on
+         * this scheduler. Nested regions (a parallel stencil inside a multi-start) share its worker threads, so they
+         * fill the machine without oversubscribing it.
+         *
+         * @param IN_SCHEDULER The scheduler (default: aux::work_stealing_scheduler::shared()).
+         */
+        void set_scheduler (std::shared_ptr<aux::work_stealing_scheduler> IN_SCHEDULER) noexcept {
+            this->scheduler_ = std::move(IN_SCHEDULER);
+        }
+
+        /**
+         * @brief Toggles parallel evaluation of the finite difference stencil.
+         *
+         * When enabled, the perturbed points of the finite difference derivatives are evaluated as concurrent tasks
+         * on the scheduler (see set_scheduler()), one per optimisation variable.
+         *
+         * @note By default this is off. The objective function and the constraint functions must be thread-safe.
+         */
+        void toggle_parallel_derivatives () {
+            this->use_parallel_derivatives = !this->use_parallel_derivatives;
+            if (this->use_parallel_derivatives) {VERBOSE_PRINT("USING PARALLEL FINITE DIFFERENCES");}
+            else {VERBOSE_PRINT("NOT USING PARALLEL FINITE DIFFERENCES");}
+        }
+
+        /**
+         * @brief Toggles speculative finite differences overlapping the secant method step.
+         *
+         * When enabled, the secant method step evaluates its first trial point on the calling thread while the
+         * finite difference stencil around that trial point is evaluated as concurrent tasks on the scheduler (see
+         * set_scheduler()). If the trial point is accepted, which is the common case, the next derivatives reuse
+         * the stencil and the gradient costs no extra latency. If it is rejected, the stencil tasks that have not
+         * started yet are cancelled and the values are dropped.
+         *
+         * @note By default this is off. The objective function and the constraint functions must be thread-safe.
+         * It has no effect on the classic gradient descent path or on asynchronous objective functions (whose stencil
+         * is already in flight at once). It is also switched off while dependency masks are in use, i.e. as soon as a
+         * constraint declares its dependencies (see create_constraint), because the masked stencil reuses the
+         * per-constraint penalties of the accepted point instead; the toggle stays set but has no effect. Dropped
+         * evaluations are counted in the function call count.
+         */
+        void toggle_speculative_derivatives () {
+            this->use_speculative_derivatives = !this->use_speculative_derivatives;
+            if (this->use_speculative_derivatives) {VERBOSE_PRINT("USING SPECULATIVE FINITE DIFFERENCES");}
+            else {VERBOSE_PRINT("NOT USING SPECULATIVE FINITE DIFFERENCES");}
+        }
+
+        /**
+         * @brief Toggles the projected arc search.
+         *
+         * A step that leaves the box is clipped by the bounds projection, so along the step the trial points follow a
+         * piecewise-linear projected path x(a) = P(x - a * d) whose breakpoints are where coordinates hit their bounds.
+         * Past the last breakpoint the path stops moving, and the secant and back-tracking searches would shrink the
+         * learning rate through a run of identical clipped points. With the projected arc search, every step starts
+         * from a learning rate of at most the last breakpoint, so no two trial points of a step coincide, and a step
+         * whose path does not move at all (every coordinate pushed against its bound) costs no evaluation.
+         *
+         * @note By default this is off.
+         */
+        void toggle_projected_arc_search () {
+            this->use_projected_arc = !this->use_projected_arc;
+            if (this->use_projected_arc) {VERBOSE_PRINT("USING PROJECTED ARC SEARCH");}
+            else {VERBOSE_PRINT("NOT USING PROJECTED ARC SEARCH");}
+        }
+
+        /**
+         * @brief Toggles the projection onto the equality constraints.
+         *
+         * Under the penalty, an equality ("=") constraint adds 1e9 times its violation to the objective, so the
+         * iterates bounce across the constraint surface and rarely converge. With the projection, equality
+         * constraints are left out of the penalty and enforced geometrically instead: the derivatives are projected
+         * onto the tangent space of the constraints before every step, and after every step a few Gauss-Newton
+         * iterations on the residuals (Jacobian from forward differences) return the point to the constraints
+         * (see set_equality_projection_iterations()). The initial guess is projected the same way.
+         *
+         * Each Gauss-Newton iteration evaluates the equality constraints once per variable plus once; the objective is
+         * evaluated once more per step, at the projected point. Inequality constraints keep their penalty.
+         *
+         * @note By default this is off. Equality constraints of a joint evaluator (see set_joint_evaluator()) are
+         * not projected.
+         */
+        void toggle_equality_projection () {
+            this->use_equality_projection = !this->use_equality_projection;
+            if (this->constraint_manager_) {this->constraint_manager_->equalities_projected = this->use_equality_projection;}
+            if (this->use_equality_projection) {VERBOSE_PRINT("USING EQUALITY PROJECTION");}
+            else {VERBOSE_PRINT("NOT USING EQUALITY PROJECTION");}
+        }
+
+        /**
+         * @brief Sets the maximum number of Gauss-Newton iterations of the equality projection (default: 5).
+         *
+         * @param IN_ITERATIONS The maximum number of iterations per projection.
+         */
+        void set_equality_projection_iterations (std::size_t IN_ITERATIONS) noexcept {
+            this->equality_projection_iterations = IN_ITERATIONS;
+        }
+
+        /**
+         * @brief Toggles the feasibility restoration phase.
+         *
+         * When the initial guess violates the constraints, the first iterations are dominated by the penalty: the
+         * derivatives, and with them the highest derivatives that scale the steps, are calibrated to the penalty
+         * rather than the objective. With feasibility restoration, a solve from an infeasible point first minimises
+         * the constraint violation alone, without calling the objective function: Gauss-Newton iterations on the
+         * residuals of the violated constraints (Jacobian from forward differences, minimum-norm correction,
+         * projected onto the bounds) until no constraint is violated (see set_feasibility_restoration_iterations()).
+         * The main solve then starts from the restored point.
+         *
+         * @note By default this is off. A feasible initial guess costs one evaluation of the constraints. "!="
+         * constraints and the constraints of a joint evaluator (see set_joint_evaluator()) are not restored.
+         */
+        void toggle_feasibility_restoration () {
+            this->use_feasibility_restoration = !this->use_feasibility_restoration;
+            if (this->use_feasibility_restoration) {VERBOSE_PRINT("USING FEASIBILITY RESTORATION");}
+            else {VERBOSE_PRINT("NOT USING FEASIBILITY RESTORATION");}
+        }
+
+        /**
+         * @brief Sets the maximum number of Gauss-Newton iterations of the feasibility restoration (default: 50).
+         *
+         * @param IN_ITERATIONS The maximum number of iterations.
+         */
+        void set_feasibility_restoration_iterations (std::size_t IN_ITERATIONS) noexcept {
+            this->feasibility_restoration_iterations = IN_ITERATIONS;
+        }
+
+        /**
+         * @brief Sets the maximum number of evaluations of an asynchronous objective function kept in flight.
+         *
+         * With an objective function returning futures, the finite difference stencil is issued at once and the
+         * back-tracking line search issues its next trial points (at the successively reduced learning rates) ahead
+         * of the results, up to this many evaluations at a time. Results are consumed in order, so the iterates are
+         * the same as with one evaluation at a time; trial points issued beyond the accepted one are dropped.
+         *
+         * @param IN_MAX_IN_FLIGHT The maximum number of evaluations in flight (default: 8, at least 1).
+         *
+         * @note It has no effect on synchronous objective functions. Evaluations in flight always evaluate every
+         * constraint: the infeasibility threshold and short-circuit constraint evaluation do not apply to them.
+         */
+        void set_max_in_flight (std::size_t IN_MAX_IN_FLIGHT) noexcept {
+            this->max_in_flight = std::max<std::size_t>(IN_MAX_IN_FLIGHT, 1);
+        }
+
+        /**
+         * @brief Sets the automatic normalisation of the optimisation variables.
+         *
+         * With variables of very different magnitudes (e.g. pressures in Pa next to ratios in [0, 1]), one learning
+         * rate along the raw gradient is badly conditioned. Variable scaling lets the solver step in a normalised
+         * space x = D * y instead: the gradient with respect to y is D * g, so the step in x becomes
+         * -learning_rate * D^2 * g. The solver still evaluates the objective function and reports results in the
+         * original variables, so the mapping is transparent.
+         * <ul>
+         * <li> gd::variable_scaling::bounds takes D from the bound ranges, so y lies in a unit box and every variable
+         * moves across its range at the same rate.
+         * <li> gd::variable_scaling::curvature takes D^2 from a diagonal secant estimate of the inverse curvature,
+         * (x_k - x_k-1) / (g_k - g_k-1) per variable, which costs no extra function calls; a learning rate of 1 is
+         * then a diagonal Newton step. Variables without an estimate yet take the geometric mean of the others, and
+         * all are left unscaled in the first iteration.
+         * </ul>
+         * The learning rate applies in the normalised space.
+         *
+         * @param IN_SCALING The normalisation (default: gd::variable_scaling::none).
+         *
+         * @note Bound scaling requires finite lower and upper bounds on every variable.
+         */
+        void set_variable_scaling (gd::variable_scaling IN_SCALING) noexcept {
+            this->variable_scaling_ = IN_SCALING;
+            if (IN_SCALING == gd::variable_scaling::bounds) {VERBOSE_PRINT("USING BOUND BASED VARIABLE SCALING");}
+            else if (IN_SCALING == gd::variable_scaling::curvature) {VERBOSE_PRINT("USING CURVATURE BASED VARIABLE SCALING");}
+            else {VERBOSE_PRINT("NOT USING VARIABLE SCALING");}
+        }
+
+        /**
+         * @brief Sets the learning rate policy.
+         *
+         * After the derivatives of every iteration, the policy sets the learning rate the next step starts from. By
+         * default (gd::reset_on_new_high) it is reset to 1 whenever a derivative exceeds its largest magnitude so far,
+         * so the secant search spends evaluations rediscovering a scale it already knew. gd::rescale_on_new_high,
+         * gd::armijo_memory and gd::barzilai_borwein keep that scale instead (see learning_rate_policy.h).
+         *
+         * @param IN_POLICY The policy, or nullptr to restore the default.
+         *
+         * @code{.cpp}
+         * // example
+         * gradient_operator->set_learning_rate_policy(std::make_shared<gd::barzilai_borwein<double>>());
+         * @endcode
+         */
+        void set_learning_rate_policy (std::shared_ptr<const gd::learning_rate_policy<returnType>> IN_POLICY) noexcept {
+            this->learning_rate_policy_ = std::move(IN_POLICY);
+        }
+
+        /**
+         * @brief Toggles deterministic mode: results that do not depend on thread count or timing.
+         *
+         * The parallel paths already reduce in a fixed order: every finite difference derivative comes from its
+         * own evaluation, concurrent constraint penalties are summed in the serial evaluation order, evaluations in
+         * flight are consumed in issue order and solve_multi_start() breaks ties towards the earlier start. In
+         * deterministic mode, the remaining timing-dependent shortcuts are disabled as well:
+         * <ul>
+         * <li> Concurrent constraint evaluation does not skip constraints past a short-circuit cutoff.
+         * <li> Speculative finite differences are never cancelled, so the function call count is reproducible.
+         * <li> The shared evaluation cache is not consulted, since its content depends on other solves.
+         * </ul>
+         * perform_gradient_decent() then returns the same value, point and function call count with 1 or N
+         * worker threads.
+         *
+         * @note By default this is off. The objective and constraint functions must themselves be deterministic.
+         */
+        void toggle_deterministic () {
+            this->use_deterministic = !this->use_deterministic;
+            if (this->use_deterministic) {VERBOSE_PRINT("USING DETERMINISTIC MODE");}
+            else {VERBOSE_PRINT("NOT USING DETERMINISTIC MODE");}
+        }
+
+        /**
+         * @brief Toggles concurrent evaluation of the constraints.
+         *
+         * When enabled, independent constraints are evaluated as concurrent tasks on the scheduler (see
+         * set_scheduler()), which pays off when constraints are as costly as the objective function.
+         *
+         * @note By default this is off. The constraint functions must be thread-safe.
+         */
+        void toggle_parallel_constraints () {
+            this->use_parallel_constraints = !this->use_parallel_constraints;
+            if (this->use_parallel_constraints) {VERBOSE_PRINT("USING PARALLEL CONSTRAINT EVALUATION");}
+            else {VERBOSE_PRINT("NOT USING PARALLEL CONSTRAINT EVALUATION");}
+        }
+
+        /**
+         * @brief Toggles short-circuit constraint evaluation at back-tracking trial points.
+         *
+         * A back-tracking trial point is rejected as soon as its value exceeds the current optimal value. When
+         * short-circuiting is enabled, the objective function is evaluated first and the remaining constraints are
+         * skipped once the accumulated penalty already guarantees the rejection. Only the accept/reject decision
+         * uses such values, so the iterates are unchanged.
+         *
+         * @note By default this is off. It has no effect on the secant method path, which uses trial values
+         * numerically.
+         */
+        void toggle_constraint_short_circuit () {
+            this->use_constraint_short_circuit = !this->use_constraint_short_circuit;
+            if (this->use_constraint_short_circuit) {VERBOSE_PRINT("USING SHORT-CIRCUIT CONSTRAINT EVALUATION");}
+            else {VERBOSE_PRINT("NOT USING SHORT-CIRCUIT CONSTRAINT EVALUATION");}
+        }
+
+        /**
+         * @brief Sets the penalty margin above which a trial point is infeasible enough to skip the objective function.
+         *
+         * With a threshold set, two kinds of evaluation only compare their value against a value to beat: the trial
+         * points of the back-tracking line search, and the point at the halved learning rate that the secant method
+         * compares against its best probe. These evaluate their constraints before the objective function, cheapest
+         * first (see the cost hint of create_constraint). As soon as the accumulated penalty exceeds the value to beat
+         * by more than the threshold, no objective value can make the point better. The remaining constraints and the
+         * objective function are then skipped and the point is rejected. All other evaluations still call the
+         * objective function and return its full value plus penalty, because they use the value itself: the start
+         * value, the first secant trial point and the probes of the secant search, the finite difference stencils, and
+         * the trial points of an asynchronous objective function.
+         *
+         * @param IN_THRESHOLD The penalty margin; choose it above the largest magnitude of the objective function,
+         *                     so skipped points are certainly worse than the point they are compared with.
+         *
+         * @note By default there is no threshold. Skipped objective calls are not counted in the function call count.
+         */
+        void set_infeasibility_threshold (returnType IN_THRESHOLD) {
+            this->infeasibility_threshold = IN_THRESHOLD;
+        }
+
+        /**
+         * @brief Toggles warm starts from near matches in the result cache.
+         *
+         * When warm starts are enabled and the exact problem is not in the result cache, the optimiser looks for
+         * a cached problem of the same family (identical except for the initial guess) whose initial guess lies
+         * within the warm start radius, and starts from its optimal point instead of the given initial guess.
+         *
+         * @note By default this is off. It has no effect without a result cache (see set_result_cache()).
+         */
+        void toggle_warm_start () {
+            this->use_warm_start = !this->use_warm_start;
+            if (this->use_warm_start) {VERBOSE_PRINT("USING WARM STARTS FROM RESULT CACHE");}
+            else {VERBOSE_PRINT("NOT USING WARM STARTS FROM RESULT CACHE");}
+        }
+
+        /**
+         * @brief Sets the largest initial guess distance considered a near match for warm starts (default: 1.0).
+         *
+         * @param IN_RADIUS The warm start radius.
+         */
+        void set_warm_start_radius (returnType IN_RADIUS) noexcept {
+            this->warm_start_radius = IN_RADIUS;
+        }
+
+        /**
+         * @brief Sets a callback invoked before every iteration.
+         *
+         * The callback receives the iteration number and the current optimal value. If it returns false, the
+         * optimisation stops early and perform_gradient_decent() returns the current optimal value and point
+         * without storing it in the result cache; stopped_early() then returns true. This is used, for example, to
+         * prune multi-start trajectories that are clearly dominated by the best result found elsewhere.
+         *
+         * @param IN_CALLBACK The callback, or an empty function to remove it.
+         */
+        void set_iteration_callback (std::function<bool(std::size_t, returnType)> IN_CALLBACK) noexcept {
+            this->iteration_callback = std::move(IN_CALLBACK);
+        }
+
+        /**
+         * @brief Returns the callback invoked before every iteration (empty if none is set).
+         */
+        [[nodiscard]] const std::function<bool(std::size_t, returnType)>& get_iteration_callback () const noexcept {
+            return this->iteration_callback;
+        }
+
+        /**
+         * @brief Returns true if the last perform_gradient_decent() was stopped by the iteration callback.
+         */
+        [[nodiscard]] bool stopped_early () const noexcept {
+            return this->state.stopped_by_callback;
+        }
+
+        /**
+         * @brief Sets the stopping tests of every solve.
+         *
+         * By default a solve stops when the last change of the optimal value plus the step length is below the
+         * tolerance (see set_tolerance()). With convergence criteria set, it instead stops as soon as one of their
+         * tests holds, and fails to converge if none holds within the maximum number of evaluations.
+         *
+         * @param IN_CRITERIA The stopping tests, or an empty set to restore the legacy test.
+         *
+         * @see gd::convergence_criteria
+         */
+        void set_convergence_criteria (gd::convergence_criteria<returnType> IN_CRITERIA) {
+            this->convergence_criteria_ = std::move(IN_CRITERIA);
+        }
+
+        /**
+         * @brief Returns the stopping test that ended the last perform_gradient_decent().
+         *
+         * @note For solve(), read gd::solver_workspace::stopped_by of the workspace instead.
+         */
+        [[nodiscard]] gd::stop_reason get_stop_reason () const noexcept {
+            return this->state.stopped_by;
+        }
+
+        /**
+         * @brief Performs gradient descent optimization.
+         *
+         * This method performs gradient descent optimisation to find the optimal point
+         * for the given function. It iteratively updates the current point, function value
+         * until convergence and derivatives until convergence or until the maximum number
+         * of iterations is reached.
+         *
+         * @tparam returnType The return type of the objective function.
+         * @tparam argType    The argument types of the objective function.
+         * @return A pair containing the optimal value and the optimal point.
+         *
+         * @details The method initializes an evaluation counter and enters a do-while loop to perform
+         * gradient descent iterations. Within each iteration:
+         * <ul>
+         * <li> The old optimal point is updated.
+         * <li> The iteration details are printed if verbosity is enabled.
+         * <li> Step scales are reset to 1.0.
+         * <li> Derivatives are calculated at the optimal point.
+         * <li> Either classic gradient descent with backtracking or step forward algorithm with secant method scaling
+         * is applied.
+         * </ul>
+         * The loop continues until the evaluation counter exceeds the maximum evaluation count
+         * or the tolerance condition is met.
+         *
+         * If gradient descent fails to converge within the specified maximum evaluation count
+         * and tolerance, a runtime error is thrown.
+         *
+         * After convergence, the optimal point and value are printed if verbosity is enabled.
+         *
+         * If a result cache is attached (see set_result_cache()), a cached result for the same problem is returned
+         * before the first iteration, and the converged result is stored in the cache.
+         *
+         * @note The algorithm uses classic gradient descent with backtracking or step forward algorithm with secant
+         * method scaling based on the `use_classic_gd` flag.
+         */
+        std::pair<returnType, std::tuple<argType...>> perform_gradient_decent () {
+            return this->solve(this->state);
+        }
+
+        /**
+         * @brief Performs gradient descent optimisation from the configured initial guess with bound parameters.
+         *
+         * The parameters are bound for this solve only (see gd::with_parameters).
+         *
+         * @param IN_PARAMETERS The parameters of the objective function.
+         * @return A pair containing the optimal value and the optimal point.
+         */
+        template<class paramsType>
+        std::pair<returnType, std::tuple<argType...>> perform_gradient_decent (const paramsType &IN_PARAMETERS) {
+            this->reset_workspace(this->state, IN_PARAMETERS, this->initial_guess);
+            try {
+                auto result = this->solve(this->state);
+                this->state.parameters = nullptr;
+                return result;
+            } catch (...) {
+                this->state.parameters = nullptr;
+                throw;
+            }
+        }
+
+        /**
+         * @brief Performs gradient descent optimisation on a caller-provided workspace.
+         *
+         * This is the reentrant form of perform_gradient_decent(): it only reads the configuration of the optimiser
+         * and keeps all mutable run state in the given workspace. Concurrent calls with distinct workspaces are safe,
+         * so one configured optimiser can serve many threads.
+         *
+         * @param IN_WORKSPACE The workspace of this solve, seeded with make_workspace() or reset_workspace().
+         * @return A pair containing the optimal value and the optimal point.
+         *
+         * @code{.cpp}
+         * // example: one configured optimiser, one workspace per thread
+         * auto ws = gradient_operator->make_workspace(std::make_tuple(1.6, -1.2));
+         * auto [minimum_value, minimum_point] = gradient_operator->solve(ws);
+         * @endcode
+         *
+         * @note The objective function, the constraint functions and the iteration callback are called concurrently
+         * when the optimiser is shared between threads, and must be thread-safe.
+         */
+        std::pair<returnType, std::tuple<argType...>> solve (workspace &IN_WORKSPACE) const {
+            workspace &ws = IN_WORKSPACE;
+            if (this->function->takes_parameters() && ws.parameters == nullptr) {
+                std::cerr << "The objective function takes parameters; bind them with make_workspace() or perform_gradient_decent()" << std::endl;
+                throw std::runtime_error("The objective function takes parameters; bind them with make_workspace() or perform_gradient_decent()");
+            }
+            const bool use_result_cache = this->result_cache_ && ws.parameters == nullptr;
+            const std::tuple<argType...> start_point = ws.optimal_point;
+            std::uint64_t family = 0;
+            std::uint64_t key = 0;
+            if (use_result_cache) {
+                family = this->problem_fingerprint().value();
+                key = this->problem_fingerprint().add(start_point).value();
+                if (auto cached = this->result_cache_->find(key)) {
+                    std::tie(ws.optimal_val, ws.optimal_point) = *cached;
+                    ws.stopped_by = gd::stop_reason::result_cache;
+                    VERBOSE_PRINT("Result cache hit with optimal value: " << ws.optimal_val);
+                    return *cached;
+                }
+                if (this->use_warm_start) {
+                    if (auto near = this->result_cache_->find_near(family, start_point, this->warm_start_radius)) {
+                        ws.optimal_point = *near;
+                        ws.optimal_val = this->eval_func_at(ws, ws.optimal_point);
+                        VERBOSE_PRINT("Warm starting from result cache...");
+                    }
+                }
+            }
+
+            bool restored = this->use_feasibility_restoration && this->constraints_on && this->restore_feasibility(ws, ws.optimal_point, indices_for_args{});
+            restored = (this->projects_equalities() && this->restore_equalities(ws, ws.optimal_point, indices_for_args{})) || restored;
+            if (restored) {
+                ws.optimal_val = this->eval_func_at(ws, ws.optimal_point);
+                VERBOSE_PRINT("Restored feasibility with optimal value: " << ws.optimal_val);
+            }
+
+            std::size_t eval = 0;
+            ws.stopped_by_callback = false;
+            ws.stopped_by = gd::stop_reason::none;
+            ws.history.reset(this->convergence_criteria_.history_window());
+            ws.history.push(ws.optimal_val);
             do {
-                this->old_optimal_point = this->optimal_point;
-                VERBOSE_PRINT_("iteration @" << std::to_string(eval) << " with optimal val at " << this->optimal_val << " with point at ");
-                this->verbose_print_tuple(this->optimal_point, indices_for_args{});
-                this->step_scales.fill(1.0);
-                this->calculate_derivatives_at(this->optimal_point);
-                this->use_classic_gd ? this->step_forward_with_back_tracking(this->optimal_point) : this->step_forward_with_secant_method(this->optimal_point);
-                this->first_iteration_settings = false;
-            } while (eval++ < this->max_eval && this->get_tolerance() > this->tolerance);
-
-
-            if (eval >= this->max_eval && this->current_tolerance > this->tolerance) {
-                throw std::runtime_error("Gradient descent failed to converge");
+                if (this->iteration_callback && !this->iteration_callback(eval, ws.optimal_val)) {
+                    ws.stopped_by_callback = true;
+                    ws.stopped_by = gd::stop_reason::iteration_callback;
+                    VERBOSE_PRINT("GD STOPPED BY ITERATION CALLBACK at iteration @" << eval);
+                    return std::make_pair(ws.optimal_val, ws.optimal_point);
+                }
+                ws.old_optimal_point = ws.optimal_point;
+                VERBOSE_PRINT_("iteration @" << std::to_string(eval) << " with optimal val at " << ws.optimal_val << " with point at ");
+                this->verbose_print_tuple(ws.optimal_point, indices_for_args{});
+                ws.step_scales.fill(1.0);
+                this->calculate_derivatives_at(ws, ws.optimal_point);
+                if (this->projects_equalities()) {this->project_derivatives_onto_equalities(ws, indices_for_args{});}
+                ws.previous_point = ws.optimal_point;
+                ws.previous_derivatives = ws.derivatives;
+                ws.previous_derivatives_valid = true;
+                this->use_classic_gd ? this->step_forward_with_back_tracking(ws, ws.optimal_point) : this->step_forward_with_secant_method(ws, ws.optimal_point);
+                ws.first_iteration_settings = false;
+            } while (eval++ < this->max_eval && !this->has_converged(ws));
+
+
+            if (ws.stopped_by == gd::stop_reason::none) {
+                if (!this->convergence_criteria_.empty() || ws.current_tolerance > this->tolerance) {
+                    throw std::runtime_error("Gradient descent failed to converge");
+                }
+                ws.stopped_by = gd::stop_reason::max_eval;
             }
+            VERBOSE_PRINT("GD STOPPED BY " << gd::to_string(ws.stopped_by));
             _VERBOSE_PRINT_("GD CONVERGED with optimal point at: ");
-            this->verbose_print_tuple(this->optimal_point, indices_for_args{});
-            VERBOSE_PRINT("with optimal value: " << this->optimal_val);
-            VERBOSE_PRINT("Number of times fun called: " << this->func_call_count);
+            this->verbose_print_tuple(ws.optimal_point, indices_for_args{});
+            VERBOSE_PRINT("with optimal value: " << ws.optimal_val);
+            VERBOSE_PRINT("Number of times fun called: " << ws.func_call_count);
+
+            if (use_result_cache) {this->result_cache_->insert(key, family, start_point, ws.optimal_val, ws.optimal_point);}
+            return std::make_pair(ws.optimal_val, ws.optimal_point);
+        }
+
+        /**
+         * @brief Solves from several initial guesses in parallel and returns the best result.
+         *
+         * Every start is solved as a task on the scheduler (see set_scheduler()) with its own workspace. Starts that
+         * fail to converge are skipped.
+         *
+         * @param IN_STARTS The initial guesses.
+         * @return A pair containing the lowest optimal value and its optimal point; ties go to the earlier start.
+         *
+         * @code{.cpp}
+         * // example
+         * auto [minimum_value, minimum_point] = gradient_operator->solve_multi_start({{1.6, -1.2}, {-1.0, 1.0}, {0.5, 0.5}});
+         * @endcode
+         *
+         * @note A runtime_error is thrown if no start converges.
+         */
+        std::pair<returnType, std::tuple<argType...>> solve_multi_start (const std::vector<std::tuple<argType...>> &IN_STARTS) const {
+            std::vector<std::optional<std::pair<returnType, std::tuple<argType...>>>> results(IN_STARTS.size());
+            aux::parallel_for(this->get_scheduler(), IN_STARTS.size(), [this, &IN_STARTS, &results] (std::size_t IN_INDEX) {
+                try {
+                    workspace ws = this->make_workspace(IN_STARTS[IN_INDEX]);
+                    results[IN_INDEX] = this->solve(ws);
+                } catch (std::exception &e) {
+                    VERBOSE_PRINT("Start " << IN_INDEX << " failed: " << e.what());
+                }
+            });
 
-            return std::make_pair(this->optimal_val, this->optimal_point);
+            std::optional<std::pair<returnType, std::tuple<argType...>>> best;
+            for (auto &each : results) {
+                if (each && (!best || each->first < best->first)) {best = std::move(each);}
+            }
+            if (!best) {
+                std::cerr << "No start of the multi-start converged" << std::endl;
+                throw std::runtime_error("No start of the multi-start converged");
+            }
+            return *best;
         }
     protected:
         /**
@@ -573,29 +1620,25 @@ namespace gd {
          */
         std::unique_ptr<gd::function_wrapper<returnType, argType...>> function;
         /**
-         * @brief Tuple representing the optimal point.
+         * @brief Tuple representing the initial guess.
          */
-        std::tuple<argType...> optimal_point;
+        std::tuple<argType...> initial_guess;
         /**
-         * @brief Tuple representing the old optimal point.
+         * @brief Workspace used by perform_gradient_decent().
          */
-        std::tuple<argType...> old_optimal_point;
-        /**
-         * @brief Value of the objective function at the optimal point.
-         */
-        returnType optimal_val;
+        workspace state;
         /**
          * @brief Maximum number of evaluations for optimization (default: 1000).
          */
         std::size_t max_eval = 1000;
         /**
-         * @brief Tolerance for convergence criteria (default: 0.00001F).
+         * @brief Stopping tests of every solve; empty selects the legacy tolerance test.
          */
-        returnType tolerance = 0.00001F;
+        gd::convergence_criteria<returnType> convergence_criteria_;
         /**
-         * @brief Current tolerance value (default: 0.002F).
+         * @brief Tolerance for convergence criteria (default: 0.00001F).
          */
-        returnType current_tolerance = 0.002F;
+        returnType tolerance = 0.00001F;
         /**
          * @brief Tuple representing the lower bounds for optimization variables.
          */
@@ -605,37 +1648,25 @@ namespace gd {
          */
         std::tuple<argType...> upper_bounds {};
         /**
-         * @brief Learning rate for gradient descent optimization.
+         * @brief Initial learning rate of every solve (default: 1.0).
          */
-        returnType learning_rate;
+        returnType initial_learning_rate = 1.0;
         /**
          * @brief Finite difference step for numerical differentiation.
          */
         returnType finite_difference_step;
-        /**
-         * @brief Array of step scales for optimization variables.
-         */
-        std::array<returnType, sizeof...(argType)> step_scales;
-        /**
-         * @brief Tuple representing the derivatives of the objective function.
-         */
-        std::tuple<argType...> derivatives {};
-        /**
-         * @brief Tuple representing the high values of the derivatives.
-         */
-        std::tuple<argType...> derivative_high {};
         /**
          * @brief  Unique pointer to the constraint manager. (Polymorphic class object)
          */
         std::unique_ptr<typename aux::constraints_system<returnType, argType...>::constraint_manager_base> constraint_manager_;
-        /**
-         * @brief Flag indicating if it's the first iteration settings.
-         */
-        bool first_iteration_settings = true;
         /**
          * @brief Flag indicating if constraints are enabled.
          */
         bool constraints_on = false;
+        /**
+         * @brief Unique pointer to the joint objective and constraint evaluator (optional).
+         */
+        std::unique_ptr<typename aux::constraints_system<returnType, argType...>::joint_evaluator> joint_evaluator_;
         /**
          * @brief Flag indicating if classic gradient descent algorithm is used.
          */
@@ -645,9 +1676,135 @@ namespace gd {
          */
         bool use_scaling = false;
         /**
-         * @brief Number of times the objective function is called.
+         * @brief Shared pointer to the persistent result cache (optional).
          */
-        std::size_t func_call_count = 0;
+        std::shared_ptr<gd::result_cache<returnType, argType...>> result_cache_;
+        /**
+         * @brief Shared pointer to the cross-process evaluation cache (optional).
+         */
+        std::shared_ptr<gd::shared_eval_cache<returnType, argType...>> eval_cache_;
+        /**
+         * @brief Shared pointer to the scheduler of the parallel paths (default: the shared scheduler).
+         */
+        std::shared_ptr<aux::work_stealing_scheduler> scheduler_;
+        /**
+         * @brief Flag indicating if the finite difference stencil is evaluated in parallel.
+         */
+        bool use_parallel_derivatives = false;
+        /**
+         * @brief Flag indicating if the finite difference stencil is evaluated speculatively during the secant step.
+         */
+        bool use_speculative_derivatives = false;
+        /**
+         * @brief Flag indicating if steps are limited to the last breakpoint of the projected path.
+         */
+        bool use_projected_arc = false;
+        /**
+         * @brief Flag indicating if equality constraints are enforced by projection instead of the penalty.
+         */
+        bool use_equality_projection = false;
+        /**
+         * @brief Maximum number of Gauss-Newton iterations of the equality projection (default: 5).
+         */
+        std::size_t equality_projection_iterations = 5;
+        /**
+         * @brief Flag indicating if a solve from an infeasible point first restores feasibility.
+         */
+        bool use_feasibility_restoration = false;
+        /**
+         * @brief Maximum number of Gauss-Newton iterations of the feasibility restoration (default: 50).
+         */
+        std::size_t feasibility_restoration_iterations = 50;
+        /**
+         * @brief Maximum number of evaluations of an asynchronous objective function in flight (default: 8).
+         */
+        std::size_t max_in_flight = 8;
+        /**
+         * @brief Flag indicating if timing-dependent shortcuts are disabled for reproducible results.
+         */
+        bool use_deterministic = false;
+        /**
+         * @brief Normalisation of the optimisation variables (default: none).
+         */
+        gd::variable_scaling variable_scaling_ = gd::variable_scaling::none;
+        /**
+         * @brief Learning rate policy; nullptr selects gd::reset_on_new_high.
+         */
+        std::shared_ptr<const gd::learning_rate_policy<returnType>> learning_rate_policy_;
+        /**
+         * @brief Flag indicating if the constraints are evaluated concurrently.
+         */
+        bool use_parallel_constraints = false;
+        /**
+         * @brief Flag indicating if constraint evaluation stops once a trial point is known to be rejected.
+         */
+        bool use_constraint_short_circuit = false;
+        /**
+         * @brief Penalty above which the objective function is skipped (default: none).
+         */
+        returnType infeasibility_threshold = std::numeric_limits<returnType>::max();
+        /**
+         * @brief Identifier of the objective function used in the problem fingerprint.
+         */
+        std::string objective_id;
+        /**
+         * @brief Serialised objective parameters used in the problem fingerprint.
+         */
+        std::string objective_parameters;
+        /**
+         * @brief Flag indicating if near matches in the result cache are used as warm starts.
+         */
+        bool use_warm_start = false;
+        /**
+         * @brief Largest initial guess distance considered a near match (default: 1.0).
+         */
+        returnType warm_start_radius = 1.0;
+
+        /**
+         * @brief Callback invoked before every iteration; returning false stops the optimisation (optional).
+         */
+        std::function<bool(std::size_t, returnType)> iteration_callback;
+
+        /**
+         * @brief Returns the learning rate policy.
+         */
+        const gd::learning_rate_policy<returnType>& get_learning_rate_policy () const noexcept {
+            static const gd::reset_on_new_high<returnType> default_policy;
+            return this->learning_rate_policy_ ? *this->learning_rate_policy_ : default_policy;
+        }
+
+        /**
+         * @brief Returns the scheduler of the parallel paths.
+         */
+        aux::work_stealing_scheduler& get_scheduler () const {
+            return this->scheduler_ ? *this->scheduler_ : *aux::work_stealing_scheduler::shared();
+        }
+
+        /**
+         * @brief Hashes the problem description, excluding the initial guess.
+         *
+         * @return The fingerprint of the problem family; add the initial guess to obtain the problem fingerprint.
+         */
+        aux::fingerprint problem_fingerprint () const noexcept {
+            aux::fingerprint hash;
+            hash.add(std::string_view(this->objective_id)).add(std::string_view(this->objective_parameters));
+            hash.add(this->lower_bounds).add(this->upper_bounds);
+            hash.add(this->initial_learning_rate).add(this->finite_difference_step).add(this->tolerance).add(this->max_eval);
+            hash.add(this->use_classic_gd).add(this->use_scaling).add(this->constraints_on).add(this->infeasibility_threshold);
+            if (this->joint_evaluator_) {
+                for (std::size_t i = 0; i < this->joint_evaluator_->constraint_count(); ++i) {
+                    hash.add(std::string_view(this->joint_evaluator_->operators[i])).add(this->joint_evaluator_->values[i]).add(this->joint_evaluator_->tolerances[i]);
+                }
+            }
+            hash.add(static_cast<std::uint8_t>(this->variable_scaling_));
+            hash.add(this->use_equality_projection).add(this->equality_projection_iterations);
+            hash.add(this->use_feasibility_restoration).add(this->feasibility_restoration_iterations);
+            if (this->learning_rate_policy_) {hash.add(std::string_view(this->learning_rate_policy_->describe()));}
+            for (const auto &each : this->convergence_criteria_.get_tests()) {
+                hash.add(static_cast<std::uint8_t>(each.kind)).add(each.threshold).add(each.window);
+            }
+            return hash;
+        }
 
         /**
          * @brief Evaluates the objective function at the specified arguments.
@@ -657,7 +1814,11 @@ namespace gd {
          * function value based on the penalty imposed by the constraint manager.
          *
          * @tparam tupleType The type of the tuple containing arguments.
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_ARGS The tuple containing arguments at which the function is evaluated.
+         * @param IN_REJECT_ABOVE If the value is only compared against this threshold (e.g. by the line search),
+         *                        constraint evaluation may stop as soon as the value is known to exceed it
+         *                        (default: no threshold).
          * @return The result of evaluating the objective function at the specified arguments.
          *
          * @details
@@ -666,21 +1827,228 @@ namespace gd {
          * the penalty from the constraint manager based on the provided arguments and adds it to the
          * objective function value. The adjusted value is then returned as the result. If constraints are
          * not enabled, the objective function is evaluated without any adjustments and the result is returned.
+         * With an infeasibility threshold (see set_infeasibility_threshold()) and a rejection threshold, the penalty
+         * is evaluated first and the objective function is skipped if the penalty exceeds the rejection threshold by
+         * more than the infeasibility threshold; the partial penalty returned then still exceeds the rejection
+         * threshold. With a joint evaluator (see
+         * set_joint_evaluator()), one call yields the objective value and its constraint penalty.
          *
          * @note
          * <ul>
          * <li> This method is noexcept, ensuring that it does not throw exceptions allowing for compile-time optimisation
          * <li> The provided arguments are forwarded to the objective function for evaluation.
+         * <li> The objective function is only called on a miss of the shared evaluation cache (see eval_objective_at()).
          * </ul>
          */
         template<class tupleType>
-        returnType eval_func_at (tupleType&& IN_ARGS) noexcept {
-            this->func_call_count++;
+        returnType eval_func_at (workspace &IN_WORKSPACE, tupleType&& IN_ARGS, returnType IN_REJECT_ABOVE = std::numeric_limits<returnType>::max()) const noexcept {
+            if (this->joint_evaluator_) {
+                std::atomic_ref<std::size_t>(IN_WORKSPACE.func_call_count).fetch_add(1, std::memory_order_relaxed);
+                const returnType value = this->joint_evaluator_->evaluate(IN_ARGS);
+                if (!this->constraints_on) {return value;}
+                return value + this->eval_penalty_at(IN_WORKSPACE, IN_ARGS, std::numeric_limits<returnType>::max());
+            }
+            if (this->constraints_on && this->infeasibility_threshold != std::numeric_limits<returnType>::max() &&
+                IN_REJECT_ABOVE < std::numeric_limits<returnType>::max() - this->infeasibility_threshold) {
+                // the objective lies within the threshold of 0, so a penalty above this cutoff rejects the point whatever its value
+                const returnType cutoff = IN_REJECT_ABOVE + this->infeasibility_threshold;
+                const returnType penalty = this->eval_penalty_at(IN_WORKSPACE, IN_ARGS, cutoff);
+                if (penalty > cutoff) {return penalty;}
+                return this->eval_objective_at(IN_WORKSPACE, std::forward<tupleType>(IN_ARGS)) + penalty;
+            }
             if (this->constraints_on) {
-                this->constraint_manager_->get_penalty(std::forward<tupleType>(IN_ARGS));
-                return this->function->eval_func_at(std::forward<tupleType>(IN_ARGS)) + this->constraint_manager_->penalty;
+                const returnType value = this->eval_objective_at(IN_WORKSPACE, IN_ARGS);
+                const bool short_circuit = this->use_constraint_short_circuit && IN_REJECT_ABOVE != std::numeric_limits<returnType>::max();
+                const returnType cutoff = short_circuit ? IN_REJECT_ABOVE - value : std::numeric_limits<returnType>::max();
+                return value + this->eval_penalty_at(IN_WORKSPACE, IN_ARGS, cutoff);
+            }
+            return this->eval_objective_at(IN_WORKSPACE, std::forward<tupleType>(IN_ARGS));
+        }
+
+        /**
+         * @brief Evaluates the constraint penalty at the specified arguments.
+         *
+         * With dependency masks (see use_dependency_masks()), a complete evaluation also stores the per-constraint
+         * penalties and the point in the workspace, so a finite difference stencil around an accepted point does
+         * not evaluate its constraints again.
+         *
+         * @tparam tupleType The type of the tuple containing arguments.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_ARGS The tuple containing arguments at which the constraints are evaluated.
+         * @param IN_CUTOFF Short-circuit threshold of the penalty (see constraint_manager_base::evaluate_penalty()).
+         * @return The penalty.
+         */
+        template<class tupleType>
+        returnType eval_penalty_at (workspace &IN_WORKSPACE, const tupleType &IN_ARGS, returnType IN_CUTOFF) const noexcept {
+            if (this->use_dependency_masks() && IN_CUTOFF == std::numeric_limits<returnType>::max()) {
+                this->constraint_manager_->evaluate_penalties(IN_ARGS, IN_WORKSPACE.constraint_penalties);
+                IN_WORKSPACE.constraint_penalties_point = IN_ARGS;
+                return std::accumulate(IN_WORKSPACE.constraint_penalties.begin(), IN_WORKSPACE.constraint_penalties.end(), returnType{});
+            }
+            aux::work_stealing_scheduler *scheduler = this->use_parallel_constraints ? &this->get_scheduler() : nullptr;
+            // Which constraints a concurrent evaluation skips past the cutoff depends on timing
+            if (scheduler != nullptr && this->use_deterministic) {IN_CUTOFF = std::numeric_limits<returnType>::max();}
+            return this->constraint_manager_->evaluate_penalty(IN_ARGS, IN_CUTOFF, scheduler);
+        }
+
+        /**
+         * @brief Evaluates the objective function alone, consulting the shared evaluation cache first.
+         *
+         * If a shared evaluation cache is attached and holds a value for the (quantised) point, that value is
+         * returned without calling the objective function. Otherwise, the objective function is called, the function
+         * call count is incremented and the value is published to the cache.
+         *
+         * @tparam tupleType The type of the tuple containing arguments.
+         * @param IN_WORKSPACE The workspace of the solve, whose function call count is incremented.
+         * @param IN_ARGS The tuple containing arguments at which the function is evaluated.
+         * @return The value of the objective function (without constraint penalty).
+         */
+        template<class tupleType>
+        returnType eval_objective_at (workspace &IN_WORKSPACE, tupleType&& IN_ARGS) const noexcept {
+            const bool use_eval_cache = this->eval_cache_ && IN_WORKSPACE.parameters == nullptr;
+            if (use_eval_cache && !this->use_deterministic) {
+                if (auto cached = this->eval_cache_->find(IN_ARGS)) {return *cached;}
+            }
+            std::atomic_ref<std::size_t>(IN_WORKSPACE.func_call_count).fetch_add(1, std::memory_order_relaxed);
+            const returnType value = this->function->eval_func_at(IN_ARGS, IN_WORKSPACE.parameters);
+            if (use_eval_cache) {this->eval_cache_->insert(IN_ARGS, value);}
+            return value;
+        }
+
+        /**
+         * @brief Returns true if finite differences reuse the penalties of constraints that do not read a variable.
+         */
+        bool use_dependency_masks () const noexcept {
+            return this->constraints_on && this->constraint_manager_->has_dependencies();
+        }
+
+        /**
+         * @brief Evaluates the objective function at a finite difference point.
+         *
+         * The point differs from the base point of the stencil in one variable only. With dependency masks (see
+         * use_dependency_masks()), constraints that do not read that variable are not evaluated; their penalties
+         * at the base point, stored in the workspace, are reused. Otherwise this is eval_func_at().
+         *
+         * @tparam tupleType The type of the tuple containing arguments.
+         * @param IN_WORKSPACE The workspace of the solve, holding the penalties at the base point.
+         * @param IN_ARGS The tuple containing arguments at which the function is evaluated.
+         * @param IN_VARIABLE The index of the perturbed variable.
+         * @return The value of the objective function plus the constraint penalty.
+         */
+        template<class tupleType>
+        returnType eval_func_along (workspace &IN_WORKSPACE, tupleType&& IN_ARGS, std::size_t IN_VARIABLE) const noexcept {
+            if (!this->use_dependency_masks()) {return this->eval_func_at(IN_WORKSPACE, std::forward<tupleType>(IN_ARGS));}
+            returnType value;
+            if (this->joint_evaluator_) {
+                std::atomic_ref<std::size_t>(IN_WORKSPACE.func_call_count).fetch_add(1, std::memory_order_relaxed);
+                value = this->joint_evaluator_->evaluate(IN_ARGS);
+            } else {
+                value = this->eval_objective_at(IN_WORKSPACE, IN_ARGS);
+            }
+            return value + this->constraint_manager_->evaluate_penalty_along(IN_ARGS, IN_VARIABLE, IN_WORKSPACE.constraint_penalties);
+        }
+
+        /**
+         * @brief Evaluates the objective function at a trial point while speculatively evaluating its stencil.
+         *
+         * The forward finite difference points around the trial point (with unit step scales, as used by the next
+         * iteration) are evaluated as tasks on the scheduler while the calling thread evaluates the trial point.
+         * If the trial point is worse than the current optimal value, the tasks that have not started are
+         * cancelled (in deterministic mode they run to completion). Otherwise the stencil values are kept in the
+         * workspace for calculate_derivatives_at().
+         *
+         * @tparam i The indices of the optimisation variables.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The trial point.
+         * @return The value of the objective function at the trial point.
+         */
+        template <std::size_t... i>
+        returnType eval_func_speculating (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) const noexcept {
+            workspace &ws = IN_WORKSPACE;
+            std::atomic<bool> cancelled = false;
+            auto speculate_at = [this, &ws, &IN_POINT, &cancelled] <std::size_t i_> () {
+                if (cancelled.load(std::memory_order_relaxed)) {return;}
+                std::tuple<argType...> tuple_ = std::make_tuple((std::get<i>(IN_POINT) * ((i == i_) ? (1.0F + this->finite_difference_step) : 1.0F))...);
+                std::get<i_>(ws.speculative_values) = this->eval_func_at(ws, tuple_);
+            };
+            ws.speculative_valid = false;
+            aux::task_group group(this->get_scheduler());
+            (group.run([&speculate_at] () {speculate_at.template operator()<i>();}),...);
+            const returnType value = this->eval_func_at(ws, IN_POINT);
+            const bool rejected = value > ws.optimal_val;
+            // Cancelling makes the function call count depend on timing
+            if (rejected && !this->use_deterministic) {cancelled.store(true, std::memory_order_relaxed);}
+            bool failed = false;
+            try {group.wait();}
+            catch (std::exception &e) {
+                // the stencil is evaluated again by calculate_derivatives_at(), where a failure propagates
+                std::cerr << "Speculative finite differences failed: " << e.what() << std::endl;
+                failed = true;
+            }
+            ws.speculative_point = IN_POINT;
+            ws.speculative_valid = !rejected && !failed;
+            return value;
+        }
+
+        /**
+         * @brief Evaluates an asynchronous objective function at several points with evaluations in flight.
+         *
+         * Up to max_in_flight evaluations are issued ahead; values are completed in order, adding the constraint
+         * penalty on the calling thread as each one arrives.
+         *
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINTS The points.
+         * @param OUT_VALUES Receives the value (objective function plus penalty) at every point.
+         * @param IN_COUNT The number of points.
+         * @param IN_STENCIL True if point k is the finite difference point along variable k (see eval_func_along()).
+         */
+        void eval_func_in_flight (workspace &IN_WORKSPACE, const std::tuple<argType...> *IN_POINTS, returnType *OUT_VALUES, std::size_t IN_COUNT, bool IN_STENCIL) const {
+            std::deque<std::future<returnType>> in_flight;
+            std::size_t issued = 0;
+            for (std::size_t k = 0; k < IN_COUNT; ++k) {
+                while (issued < IN_COUNT && in_flight.size() < this->max_in_flight) {in_flight.push_back(this->issue_objective_at(IN_WORKSPACE, IN_POINTS[issued++]));}
+                OUT_VALUES[k] = this->complete_func_at(IN_WORKSPACE, IN_POINTS[k], in_flight.front(), IN_STENCIL ? k : sizeof...(argType));
+                in_flight.pop_front();
+            }
+        }
+
+        /**
+         * @brief Issues an evaluation of the objective function, consulting the shared evaluation cache first.
+         *
+         * @param IN_WORKSPACE The workspace of the solve, whose function call count is incremented.
+         * @param IN_ARGS The point.
+         * @return The future value of the objective function (without constraint penalty).
+         */
+        std::future<returnType> issue_objective_at (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_ARGS) const {
+            if (this->eval_cache_ && IN_WORKSPACE.parameters == nullptr && !this->use_deterministic) {
+                if (auto cached = this->eval_cache_->find(IN_ARGS)) {
+                    std::promise<returnType> ready;
+                    ready.set_value(*cached);
+                    return ready.get_future();
+                }
+            }
+            std::atomic_ref<std::size_t>(IN_WORKSPACE.func_call_count).fetch_add(1, std::memory_order_relaxed);
+            return this->function->eval_func_async(IN_ARGS, IN_WORKSPACE.parameters);
+        }
+
+        /**
+         * @brief Waits for an issued evaluation and adds the constraint penalty.
+         *
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_ARGS The point.
+         * @param IN_VALUE The future value of the objective function at the point.
+         * @param IN_VARIABLE For a finite difference point, the index of the perturbed variable; otherwise the
+         *                    number of variables.
+         * @return The value of the objective function plus the constraint penalty.
+         */
+        returnType complete_func_at (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_ARGS, std::future<returnType> &IN_VALUE, std::size_t IN_VARIABLE) const {
+            const returnType value = IN_VALUE.get();
+            if (this->eval_cache_ && IN_WORKSPACE.parameters == nullptr) {this->eval_cache_->insert(IN_ARGS, value);}
+            if (!this->constraints_on) {return value;}
+            if (IN_VARIABLE < sizeof...(argType) && this->use_dependency_masks()) {
+                return value + this->constraint_manager_->evaluate_penalty_along(IN_ARGS, IN_VARIABLE, IN_WORKSPACE.constraint_penalties);
             }
-            return this->function->eval_func_at(std::forward<tupleType>(IN_ARGS));
+            return value + this->eval_penalty_at(IN_WORKSPACE, IN_ARGS, std::numeric_limits<returnType>::max());
         }
 
         /**
@@ -692,6 +2060,7 @@ namespace gd {
          * based on the Secant Method. If the updated optimal value is lower than the current optimal value,
          * the current tolerance is updated, and the process continues.
          *
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_POINT The current point at which the step forward is performed.
          *
          * @details
@@ -699,8 +2068,9 @@ namespace gd {
          * using the Secant Method. It first creates the next point using bounds projection and evaluates
          * the objective function at that point. If the objective function value at the new point is greater
          * than the current optimal value, the learning rate is adjusted using the Secant Method, and the
-         * process is repeated with the updated learning rate. If the updated optimal value is lower than
-         * the current optimal value, the current tolerance is updated, and the process continues.
+         * process is repeated with the updated learning rate. The step ends at the lower of the re-evaluated point
+         * and the best point probed by the secant search, and never above the current optimal value: if no probe
+         * improved on it, the step stays at the current point with a current tolerance of 0.
          *
          * @note
          * - This method is noexcept, ensuring that it does not throw exceptions.
@@ -708,18 +2078,36 @@ namespace gd {
          * - The bounds_projection method adjusts the optimal point to ensure it falls within specified bounds.
          * - The eval_func_at method is used to evaluate the objective function at different points.
          */
-        void step_forward_with_secant_method (std::tuple<argType...> IN_POINT) noexcept {
-            this->optimal_point = std::move(this->bounds_projection(this->create_next_point(IN_POINT, indices_for_args{}), indices_for_args{}));
-            returnType test_optimal = this->eval_func_at(this->optimal_point);
-            if (test_optimal > this->optimal_val) {
-                this->learning_rate += this->secant_learning_rate_scaling(test_optimal - this->optimal_val, this->optimal_val);
-                this->learning_rate *= 0.5;
-                this->optimal_point = std::move(this->bounds_projection(this->create_next_point(IN_POINT, indices_for_args{}), indices_for_args{}));
-                this->optimal_val = this->eval_func_at(this->optimal_point);
+        void step_forward_with_secant_method (workspace &IN_WORKSPACE, std::tuple<argType...> IN_POINT) const noexcept {
+            workspace &ws = IN_WORKSPACE;
+            if (this->use_projected_arc && !this->clamp_to_projected_arc(ws, IN_POINT, indices_for_args{})) {return;}
+            ws.optimal_point = this->project_trial_point(ws, this->create_next_point(ws, IN_POINT, indices_for_args{}));
+            returnType test_optimal = (this->use_speculative_derivatives && !this->use_dependency_masks() && !this->function->is_async()) ? this->eval_func_speculating(ws, ws.optimal_point, indices_for_args{}) : this->eval_func_at(ws, ws.optimal_point);
+            if (test_optimal > ws.optimal_val) {
+                std::tuple<argType...> probe_point = IN_POINT;
+                returnType probe_val = ws.optimal_val;
+                ws.learning_rate += this->secant_learning_rate_scaling(ws, test_optimal - ws.optimal_val, ws.optimal_val, probe_point, probe_val);
+                ws.learning_rate *= 0.5;
+                if (!(probe_val < ws.optimal_val)) {
+                    // no probe went below the start value: the step direction does not lead downhill at any probed length
+                    ws.optimal_point = IN_POINT;
+                    ws.current_tolerance = 0;
+                    return;
+                }
+                ws.optimal_point = this->project_trial_point(ws, this->create_next_point(ws, IN_POINT, indices_for_args{}));
+                const returnType new_val = ws.optimal_point == probe_point ? probe_val : this->eval_func_at(ws, ws.optimal_point, probe_val);
+                if (probe_val < new_val) {
+                    ws.optimal_point = std::move(probe_point);
+                    ws.current_tolerance = ws.optimal_val - probe_val;
+                    ws.optimal_val = probe_val;
+                } else {
+                    ws.current_tolerance = ws.optimal_val - new_val;
+                    ws.optimal_val = new_val;
+                }
             }
             else {
-                this->current_tolerance = std::abs(this->optimal_val - test_optimal);
-                this->optimal_val = test_optimal;
+                ws.current_tolerance = std::abs(ws.optimal_val - test_optimal);
+                ws.optimal_val = test_optimal;
             }
         }
 
@@ -731,6 +2119,7 @@ namespace gd {
          * at the adjusted point, and updates the learning rate based on backtracking. The process continues
          * until the objective function value decreases or a maximum number of iterations is reached.
          *
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_POINT The current point at which the step forward is performed.
          *
          * @details
@@ -739,7 +2128,9 @@ namespace gd {
          * to control the backtracking process. It repeatedly adjusts the optimal point using bounds projection,
          * evaluates the objective function at the adjusted point, and checks if the objective function value
          * decreases. If the objective function value decreases, the current tolerance is updated, and the process
-         * stops. If the maximum iteration limit is reached without finding a suitable point, an exception is thrown.
+         * stops. If a rejected step no longer resolves (see resolves_step()), the step stays at the current point
+         * with a current tolerance of 0, like the secant method. If the maximum iteration limit is reached without
+         * finding a suitable point, an exception is thrown.
          *
          * @note
          * - This method throws a runtime_error if it cannot find the next point using the backtracking algorithm.
@@ -747,19 +2138,31 @@ namespace gd {
          * - The bounds_projection method adjusts the optimal point to ensure it falls within specified bounds.
          * - The eval_func_at method is used to evaluate the objective function at different points.
          */
-        void step_forward_with_back_tracking (std::tuple<argType...> IN_POINT) {
+        void step_forward_with_back_tracking (workspace &IN_WORKSPACE, std::tuple<argType...> IN_POINT) const {
+            workspace &ws = IN_WORKSPACE;
             std::size_t iterative_count = 0;
             std::size_t iterative_count_max = 1000;
+            if (this->use_projected_arc && !this->clamp_to_projected_arc(ws, IN_POINT, indices_for_args{})) {return;}
+            if (this->function->is_async() && !this->joint_evaluator_) {
+                this->step_forward_with_probe_window(ws, IN_POINT, iterative_count_max);
+                return;
+            }
 
             do {
-                this->optimal_point = std::move(this->bounds_projection(this->create_next_point(IN_POINT, indices_for_args{}), indices_for_args{}));
-                returnType test_optimal = this->eval_func_at(this->optimal_point);
-                if (test_optimal > this->optimal_val) {
-                    this->learning_rate *= 0.99;
+                ws.optimal_point = this->project_trial_point(ws, this->create_next_point(ws, IN_POINT, indices_for_args{}));
+                returnType test_optimal = this->eval_func_at(ws, ws.optimal_point, ws.optimal_val);
+                if (test_optimal > ws.optimal_val) {
+                    if (!this->resolves_step(ws, ws.learning_rate, indices_for_args{})) {
+                        // shorter steps are below the resolution of the finite difference derivatives
+                        ws.optimal_point = IN_POINT;
+                        ws.current_tolerance = 0;
+                        return;
+                    }
+                    ws.learning_rate *= 0.99;
                 }
                 else {
-                    this->current_tolerance = std::abs(this->optimal_val - test_optimal);
-                    this->optimal_val = test_optimal;
+                    ws.current_tolerance = std::abs(ws.optimal_val - test_optimal);
+                    ws.optimal_val = test_optimal;
                     break;
                 }
             } while (iterative_count++ < iterative_count_max);
@@ -769,6 +2172,64 @@ namespace gd {
             }
         }
 
+        /**
+         * @brief Back-tracking step with an asynchronous objective function and trial points in flight.
+         *
+         * The trial points of the back-tracking line search only depend on the learning rate, which is reduced by
+         * the same factor after every rejection. This method issues the next trial points ahead, up to
+         * max_in_flight at a time, and consumes the values in order, so it accepts the same point at the same
+         * learning rate as step_forward_with_back_tracking() does one evaluation at a time.
+         * Trial points still in flight when a point is accepted are not waited for: their futures are kept in the
+         * workspace and dropped once they have finished.
+         *
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The current point.
+         * @param IN_MAX_PROBES The maximum number of rejected trial points.
+         */
+        void step_forward_with_probe_window (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, std::size_t IN_MAX_PROBES) const {
+            workspace &ws = IN_WORKSPACE;
+            struct probe {
+                std::tuple<argType...> point;
+                returnType learning_rate;
+                std::future<returnType> value;
+            };
+            std::deque<probe> in_flight;
+            returnType learning_rate = ws.learning_rate;
+            std::size_t issued = 0;
+            std::erase_if(ws.abandoned_evaluations, [] (const std::future<returnType> &IN_VALUE) {
+                return IN_VALUE.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            });
+            for (std::size_t count = 0; count <= IN_MAX_PROBES; ++count) {
+                while (issued <= IN_MAX_PROBES && in_flight.size() < this->max_in_flight) {
+                    ws.learning_rate = learning_rate;
+                    auto point = this->project_trial_point(ws, this->create_next_point(ws, IN_POINT, indices_for_args{}));
+                    auto value = this->issue_objective_at(ws, point);
+                    in_flight.push_back(probe{std::move(point), learning_rate, std::move(value)});
+                    learning_rate *= 0.99;
+                    ++issued;
+                }
+                probe next = std::move(in_flight.front());
+                in_flight.pop_front();
+                ws.optimal_point = next.point;
+                ws.learning_rate = next.learning_rate;
+                returnType test_optimal = this->complete_func_at(ws, next.point, next.value, sizeof...(argType));
+                if (test_optimal <= ws.optimal_val) {
+                    ws.current_tolerance = std::abs(ws.optimal_val - test_optimal);
+                    ws.optimal_val = test_optimal;
+                    for (probe &each : in_flight) {ws.abandoned_evaluations.push_back(std::move(each.value));}
+                    return;
+                }
+                if (!this->resolves_step(ws, next.learning_rate, indices_for_args{})) {
+                    ws.optimal_point = IN_POINT;
+                    ws.current_tolerance = 0;
+                    for (probe &each : in_flight) {ws.abandoned_evaluations.push_back(std::move(each.value));}
+                    return;
+                }
+                ws.learning_rate *= 0.99;
+            }
+            throw std::runtime_error("Cannot find next point using back-tracking algorithm");
+        }
+
         /**
          * @brief Helper function to set the highest derivatives for a specific index.
          *
@@ -776,16 +2237,22 @@ namespace gd {
          * for a specific index in the tuple of derivatives. It compares the absolute value of the derivative at
          * index 'i' with the absolute value of the corresponding derivative in the derivative_high tuple. If the
          * absolute value of the derivative at index 'i' is greater than the absolute value of the corresponding
-         * derivative in the derivative_high tuple, it updates the learning rate to 1.0 and updates the corresponding
-         * derivative in the derivative_high tuple.
+         * derivative in the derivative_high tuple, it records the new high and its growth in the learning rate context
+         * and updates the corresponding derivative in the derivative_high tuple.
          *
          * @tparam i The index of the derivative.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param OUT_CONTEXT The learning rate context, updated with the new high.
          */
         template <std::size_t i>
-        void set_high_derivatives_helper () {
-            if (std::abs(std::get<i>(this->derivatives)) > std::abs(std::get<i>(this->derivative_high))) {
-                this->learning_rate = 1.0;
-                std::get<i>(this->derivative_high) = std::get<i>(this->derivatives);
+        void set_high_derivatives_helper (workspace &IN_WORKSPACE, gd::learning_rate_context<returnType> &OUT_CONTEXT) const {
+            const returnType derivative = std::abs(std::get<i>(IN_WORKSPACE.derivatives));
+            const returnType high = std::abs(std::get<i>(IN_WORKSPACE.derivative_high));
+            if (derivative > high) {
+                const returnType growth = high > 0 ? derivative / high : std::numeric_limits<returnType>::infinity();
+                OUT_CONTEXT.growth = OUT_CONTEXT.new_high ? std::max(OUT_CONTEXT.growth, growth) : growth;
+                OUT_CONTEXT.new_high = true;
+                std::get<i>(IN_WORKSPACE.derivative_high) = std::get<i>(IN_WORKSPACE.derivatives);
             }
         }
 
@@ -796,11 +2263,35 @@ namespace gd {
          * It calls the set_high_derivatives_helper method for each index in the sequence.
          *
          * @tparam i The indices for which the highest derivatives are set.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param OUT_CONTEXT The learning rate context, updated with the new highs.
          * @param i_seq The index sequence specifying the indices for which the highest derivatives are set.
          */
         template <std::size_t... i>
-        void set_high_derivatives (std::index_sequence<i...>) {
-            (this->set_high_derivatives_helper<i>(),...);
+        void set_high_derivatives (workspace &IN_WORKSPACE, gd::learning_rate_context<returnType> &OUT_CONTEXT, std::index_sequence<i...>) const {
+            (this->set_high_derivatives_helper<i>(IN_WORKSPACE, OUT_CONTEXT),...);
+        }
+
+        /**
+         * @brief Sets the learning rate of the next step from the learning rate policy.
+         *
+         * The context holds the new derivative highs (see set_high_derivatives()) and, from the second iteration on,
+         * the products s^T D^-1 s and s^T y of the last step s and the change of the derivatives y, where D is the
+         * diagonal of step scales times preconditioner the next step is taken in. It is called after both are
+         * updated.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_CONTEXT The learning rate context.
+         */
+        template <std::size_t... i>
+        void update_learning_rate (workspace &IN_WORKSPACE, gd::learning_rate_context<returnType> &IN_CONTEXT, std::index_sequence<i...>) const {
+            workspace &ws = IN_WORKSPACE;
+            if (ws.previous_derivatives_valid) {
+                IN_CONTEXT.step_dot_step = (returnType{0} + ... + ((std::get<i>(ws.optimal_point) - std::get<i>(ws.previous_point)) * (std::get<i>(ws.optimal_point) - std::get<i>(ws.previous_point)) / (ws.step_scales[i] * ws.preconditioner[i])));
+                IN_CONTEXT.step_dot_change = (returnType{0} + ... + ((std::get<i>(ws.optimal_point) - std::get<i>(ws.previous_point)) * (std::get<i>(ws.derivatives) - std::get<i>(ws.previous_derivatives))));
+            }
+            ws.learning_rate = this->get_learning_rate_policy().next(IN_CONTEXT);
         }
 
         /**
@@ -809,29 +2300,67 @@ namespace gd {
          * This method calculates the derivatives at the specified indices for the given tuple of arguments.
          * It uses a finite difference method to approximate the derivatives. If an exception occurs during
          * calculation, it falls back to using the backward finite difference method. The calculated derivatives
-         * are then scaled if derivative scaling is enabled.
+         * are then scaled if derivative scaling is enabled. With parallel derivatives, the first index is evaluated
+         * on the calling thread and the others as tasks on the scheduler. If constraints declare the variables they
+         * read, their penalties at the base point are reused (or evaluated once) and only re-evaluated along those
+         * variables. Values of a speculative stencil at the same point (see eval_func_speculating()) are reused. An
+         * asynchronous objective function has its whole stencil in flight at once (see eval_func_in_flight()).
          *
          * @tparam tupleType The type of the tuple containing the arguments.
          * @tparam i The indices at which derivatives are calculated.
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_TUPLE The tuple of arguments.
          * @return A tuple containing the calculated derivatives at the specified indices.
          */
         template<class tupleType, std::size_t... i>
-        auto calculate_derivatives_at_helper (tupleType &&IN_TUPLE, std::index_sequence<i...>) noexcept {
-            auto find_derivative_at = [this] <std::size_t i_, std::size_t... index> (tupleType &&IN_TUPLE_, std::index_sequence<index...>) -> meta_types::tuple_args_type_at<i_, tupleType> {
+        std::tuple<argType...> calculate_derivatives_at_helper (workspace &IN_WORKSPACE, tupleType &&IN_TUPLE, std::index_sequence<i...>) const noexcept {
+            workspace &ws = IN_WORKSPACE;
+            auto find_derivative_at = [this, &ws] <std::size_t i_, std::size_t... index> (tupleType &&IN_TUPLE_, std::index_sequence<index...>) -> meta_types::tuple_args_type_at<i_, tupleType> {
                 meta_types::tuple_args_type_at<i_, tupleType> result{};
+                if (ws.speculative_valid && ws.step_scales.at(i_) == 1.0 && ws.speculative_point == IN_TUPLE_) {
+                    float factor = 1.0 / (std::get<i_>(IN_TUPLE_) * this->finite_difference_step);
+                    return (std::get<i_>(ws.speculative_values) - ws.optimal_val) * factor;
+                }
                 try {
-                    std::tuple<argType...> tuple_ = std::make_tuple((std::get<i>(IN_TUPLE_) * ((index == i_) ? (1.0F + this->finite_difference_step * this->step_scales.at(i_)) : 1.0F))...);
-                    float factor = 1.0 / (std::get<i_>(IN_TUPLE_) * this->finite_difference_step * this->step_scales.at(i_));
-                    result = (this->eval_func_at(tuple_) - this->optimal_val) * factor;
+                    std::tuple<argType...> tuple_ = std::make_tuple((std::get<i>(IN_TUPLE_) * ((index == i_) ? (1.0F + this->finite_difference_step * ws.step_scales.at(i_)) : 1.0F))...);
+                    float factor = 1.0 / (std::get<i_>(IN_TUPLE_) * this->finite_difference_step * ws.step_scales.at(i_));
+                    result = (this->eval_func_along(ws, tuple_, i_) - ws.optimal_val) * factor;
                 } catch (std::exception &e) {
                     std::cerr << "Using backward finite element method instead" << std::endl;
-                    std::tuple<argType...> tuple_ = std::make_tuple((std::get<i>(IN_TUPLE_) * ((index == i_) ? (1.0F - this->finite_difference_step * this->step_scales.at(i_)) : 1.0F))...);
-                    float factor = 1.0 / (std::get<i_>(IN_TUPLE_) * this->finite_difference_step * this->step_scales.at(i_));
-                    result = (this->eval_func_at(tuple_) - this->optimal_val) * factor;
+                    std::tuple<argType...> tuple_ = std::make_tuple((std::get<i>(IN_TUPLE_) * ((index == i_) ? (1.0F - this->finite_difference_step * ws.step_scales.at(i_)) : 1.0F))...);
+                    float factor = 1.0 / (std::get<i_>(IN_TUPLE_) * this->finite_difference_step * ws.step_scales.at(i_));
+                    result = (this->eval_func_along(ws, tuple_, i_) - ws.optimal_val) * factor;
                 }
                 return result;
             };
+            if (this->use_dependency_masks() && (ws.constraint_penalties.empty() || ws.constraint_penalties_point != IN_TUPLE)) {
+                this->constraint_manager_->evaluate_penalties(IN_TUPLE, ws.constraint_penalties);
+                ws.constraint_penalties_point = IN_TUPLE;
+            }
+            if (this->function->is_async() && !this->joint_evaluator_) {
+                std::array<std::tuple<argType...>, sizeof...(argType)> points {};
+                std::array<returnType, sizeof...(argType)> values {};
+                auto perturb = [this, &ws, &IN_TUPLE] <std::size_t i_> () {
+                    return std::make_tuple((std::get<i>(IN_TUPLE) * ((i == i_) ? (1.0F + this->finite_difference_step * ws.step_scales.at(i_)) : 1.0F))...);
+                };
+                ((std::get<i>(points) = perturb.template operator()<i>()),...);
+                this->eval_func_in_flight(ws, points.data(), values.data(), sizeof...(argType), true);
+                auto derivative_at = [this, &ws, &IN_TUPLE, &values] <std::size_t i_> () -> meta_types::tuple_args_type_at<i_, tupleType> {
+                    float factor = 1.0 / (std::get<i_>(IN_TUPLE) * this->finite_difference_step * ws.step_scales.at(i_));
+                    return (std::get<i_>(values) - ws.optimal_val) * factor;
+                };
+                return std::make_tuple(derivative_at.template operator()<i>()...);
+            }
+            if (this->use_parallel_derivatives && sizeof...(argType) > 1) {
+                std::tuple<argType...> result{};
+                auto find_derivative = [&find_derivative_at, &result, &IN_TUPLE] <std::size_t i_> () {
+                    std::get<i_>(result) = find_derivative_at.template operator()<i_>(std::forward<tupleType>(IN_TUPLE), indices_for_args{});
+                };
+                aux::task_group group(this->get_scheduler());
+                ((i == 0 ? find_derivative.template operator()<i>() : group.run([&find_derivative] () {find_derivative.template operator()<i>();})),...);
+                group.wait();
+                return result;
+            }
             return std::make_tuple(find_derivative_at.template operator()<i>(std::forward<tupleType>(IN_TUPLE), indices_for_args{})...);
         }
 
@@ -839,18 +2368,27 @@ namespace gd {
          * @brief Calculates derivatives at the specified point.
          *
          * This method calculates the derivatives at the specified point using the finite difference method.
-         * It then sets the highest derivatives and scales the derivatives if derivative scaling is enabled.
+         * It then sets the highest derivatives, scales the derivatives if derivative scaling is enabled, updates the
+         * preconditioner (see update_preconditioner()) and sets the learning rate of the next step from the learning
+         * rate policy.
          *
          * @tparam tupleType The type of the tuple containing the point coordinates.
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_POINT The point at which derivatives are calculated.
          * @return A tuple containing the calculated derivatives.
          */
         template<class tupleType>
-        std::tuple<argType...> calculate_derivatives_at (tupleType&& IN_POINT) {
-            this->derivatives = this->calculate_derivatives_at_helper(std::forward<tupleType>(IN_POINT), indices_for_args{});
-            this->set_high_derivatives(indices_for_args{});
-            if (this->use_scaling) this->scale(this->step_scales.data(), indices_for_args{});
-            return this->derivatives;
+        std::tuple<argType...> calculate_derivatives_at (workspace &IN_WORKSPACE, tupleType&& IN_POINT) const {
+            IN_WORKSPACE.derivatives = this->calculate_derivatives_at_helper(IN_WORKSPACE, std::forward<tupleType>(IN_POINT), indices_for_args{});
+            IN_WORKSPACE.speculative_valid = false;
+            gd::learning_rate_context<returnType> context;
+            context.learning_rate = IN_WORKSPACE.learning_rate;
+            context.first_iteration = IN_WORKSPACE.first_iteration_settings;
+            this->set_high_derivatives(IN_WORKSPACE, context, indices_for_args{});
+            if (this->use_scaling) this->scale(IN_WORKSPACE, IN_WORKSPACE.step_scales.data(), indices_for_args{});
+            this->update_preconditioner(IN_WORKSPACE, indices_for_args{});
+            this->update_learning_rate(IN_WORKSPACE, context, indices_for_args{});
+            return IN_WORKSPACE.derivatives;
         }
 
         /**
@@ -865,7 +2403,7 @@ namespace gd {
          * @return The projected point after bounds projection.
          */
         template <std::size_t... i>
-        std::tuple<argType...>&& bounds_projection (std::tuple<argType...>&& IN_POINT, std::index_sequence<i...>) noexcept {
+        std::tuple<argType...>&& bounds_projection (std::tuple<argType...>&& IN_POINT, std::index_sequence<i...>) const noexcept {
             // Project each coordinate onto the bounds if IN_POINT is outside of bounds
             (((std::get<i>(IN_POINT) < std::get<i>(this->lower_bounds)) ? std::get<i>(IN_POINT) = std::get<i>(this->lower_bounds) : std::get<i>(IN_POINT) = std::get<i>(IN_POINT)),...);
             (((std::get<i>(IN_POINT) > std::get<i>(this->upper_bounds)) ? std::get<i>(IN_POINT) = std::get<i>(this->upper_bounds) : std::get<i>(IN_POINT) = std::get<i>(IN_POINT)),...);
@@ -873,9 +2411,9 @@ namespace gd {
         }
 
         /**
-         * @brief Checks if the current optimal point lies within the defined bounds.
+         * @brief Checks if the initial guess lies within the defined bounds.
          *
-         * This method checks if each coordinate of the current optimal point lies within the bounds
+         * This method checks if each coordinate of the initial guess lies within the bounds
          * defined by the lower and upper bounds. It returns true if all coordinates are within bounds,
          * and false otherwise. The check is performed for each coordinate specified by the index sequence.
          *
@@ -885,8 +2423,8 @@ namespace gd {
         template <std::size_t... i>
         bool check_point_bounds (std::index_sequence<i...>) {
             // Check if each coordinate is within bounds
-            return ((std::get<i>(this->optimal_point) < std::get<i>(this->lower_bounds)) && ...) &&
-                   ((std::get<i>(this->optimal_point) > std::get<i>(this->upper_bounds)) && ...);
+            return ((std::get<i>(this->initial_guess) < std::get<i>(this->lower_bounds)) && ...) &&
+                   ((std::get<i>(this->initial_guess) > std::get<i>(this->upper_bounds)) && ...);
         }
 
         /**
@@ -901,7 +2439,7 @@ namespace gd {
          * @param IN_TUPLE The tuple containing elements to be printed.
          */
         template<class tupleType, std::size_t... i>
-        void verbose_print_tuple (tupleType&& IN_TUPLE, std::index_sequence<i...>) {
+        void verbose_print_tuple ([[maybe_unused]] tupleType&& IN_TUPLE, std::index_sequence<i...>) const {
 #if VERBOSITY
             _VERBOSE_PRINT_("{");   // Start of tuple printing
             // Lambda function to print elements of the tuple
@@ -928,7 +2466,7 @@ namespace gd {
          * @return The Euclidean distance between the two tuples.
          */
         template <std::size_t... i>
-        auto get_distance_tuple (std::tuple<argType...> &IN_FIRST_TUPLE, std::tuple<argType...> &IN_SEC_TUPLE, std::index_sequence<i...>) {
+        auto get_distance_tuple (const std::tuple<argType...> &IN_FIRST_TUPLE, const std::tuple<argType...> &IN_SEC_TUPLE, std::index_sequence<i...>) const {
             auto sum = (((std::get<i>(IN_FIRST_TUPLE) - std::get<i>(IN_SEC_TUPLE)) * (std::get<i>(IN_FIRST_TUPLE) - std::get<i>(IN_SEC_TUPLE))) + ...);
             return std::sqrt(sum);
         }
@@ -939,13 +2477,363 @@ namespace gd {
          * This method calculates the tolerance value by adding the current tolerance to
          * the Euclidean distance between the current optimal point and the old optimal point.
          *
+         * @param IN_WORKSPACE The workspace of the solve.
          * @return The calculated tolerance value.
          */
-        returnType get_tolerance () {
-            returnType tol = this->current_tolerance + this->get_distance_tuple(this->optimal_point, this->old_optimal_point, indices_for_args{});
+        returnType get_tolerance (const workspace &IN_WORKSPACE) const {
+            returnType tol = IN_WORKSPACE.current_tolerance + this->get_distance_tuple(IN_WORKSPACE.optimal_point, IN_WORKSPACE.old_optimal_point, indices_for_args{});
             return tol;
         }
 
+        /**
+         * @brief Checks the stopping tests after an iteration and records the one that fired.
+         *
+         * Without convergence criteria this is the legacy test get_tolerance() <= tolerance.
+         *
+         * @param IN_WORKSPACE The workspace of the solve; its history and stop reason are updated.
+         * @return True if the solve should stop.
+         */
+        bool has_converged (workspace &IN_WORKSPACE) const {
+            if (this->convergence_criteria_.empty()) {
+                if (this->get_tolerance(IN_WORKSPACE) > this->tolerance) {return false;}
+                IN_WORKSPACE.stopped_by = gd::stop_reason::tolerance;
+                return true;
+            }
+            gd::iteration_summary<returnType> summary;
+            summary.value = IN_WORKSPACE.optimal_val;
+            summary.previous_value = IN_WORKSPACE.history.ago(0);
+            summary.step_length = this->get_distance_tuple(IN_WORKSPACE.optimal_point, IN_WORKSPACE.old_optimal_point, indices_for_args{});
+            summary.gradient_norm = this->get_projected_gradient_norm(IN_WORKSPACE, indices_for_args{});
+            summary.accepted = IN_WORKSPACE.optimal_point != IN_WORKSPACE.old_optimal_point;
+            IN_WORKSPACE.history.push(IN_WORKSPACE.optimal_val);
+            IN_WORKSPACE.stopped_by = this->convergence_criteria_.check(summary, IN_WORKSPACE.history);
+            return IN_WORKSPACE.stopped_by != gd::stop_reason::none;
+        }
+
+        /**
+         * @brief Returns true if equality constraints are to be projected (see toggle_equality_projection()).
+         */
+        bool projects_equalities () const noexcept {
+            return this->use_equality_projection && this->constraints_on && this->constraint_manager_->equality_count() > 0;
+        }
+
+        /**
+         * @brief Returns the residual function of the equality constraints, for get_constraint_jacobian().
+         */
+        auto equality_residuals () const noexcept {
+            return [this] (const std::tuple<argType...> &IN_POINT, std::vector<returnType> &OUT_RESIDUALS) {
+                this->constraint_manager_->evaluate_equality_residuals(IN_POINT, OUT_RESIDUALS);
+            };
+        }
+
+        /**
+         * @brief Calculates the Jacobian of constraint residuals by forward differences.
+         *
+         * @tparam residualFuncType The type of the residual function.
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve; constraint_residuals must hold the residuals at the point,
+         *                     and constraint_jacobian receives the Jacobian.
+         * @param IN_POINT The point.
+         * @param IN_RESIDUALS Evaluates the residuals at a point: void(const std::tuple<argType...>&, std::vector<returnType>&).
+         */
+        template <class residualFuncType, std::size_t... i>
+        void get_constraint_jacobian (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, const residualFuncType &IN_RESIDUALS, std::index_sequence<i...>) const {
+            IN_WORKSPACE.constraint_jacobian.resize(IN_WORKSPACE.constraint_residuals.size() * sizeof...(argType));
+            (this->get_constraint_jacobian_column<i>(IN_WORKSPACE, IN_POINT, IN_RESIDUALS),...);
+        }
+
+        /**
+         * @brief Calculates the column of the constraint Jacobian of one variable.
+         *
+         * @tparam i Index of the optimisation variable.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The point.
+         * @param IN_RESIDUALS Evaluates the residuals at a point.
+         */
+        template <std::size_t i, class residualFuncType>
+        void get_constraint_jacobian_column (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, const residualFuncType &IN_RESIDUALS) const {
+            workspace &ws = IN_WORKSPACE;
+            std::tuple<argType...> probe = IN_POINT;
+            const returnType step = this->finite_difference_step * std::max<returnType>(std::abs(std::get<i>(IN_POINT)), 1);
+            std::get<i>(probe) += step;
+            IN_RESIDUALS(probe, ws.constraint_probe);
+            for (std::size_t e = 0; e < ws.constraint_residuals.size(); ++e) {
+                ws.constraint_jacobian[e * sizeof...(argType) + i] = (ws.constraint_probe[e] - ws.constraint_residuals[e]) / step;
+            }
+        }
+
+        /**
+         * @brief Solves the normal equations (J P J^T) l = b of the projection, with J the constraint Jacobian and P
+         * the preconditioner, by Gaussian elimination with partial pivoting.
+         *
+         * @param IN_WORKSPACE The workspace of the solve; constraint_multipliers holds b on entry and l on return.
+         * @return False if the system is singular (e.g. redundant constraints).
+         */
+        bool solve_projection_system (workspace &IN_WORKSPACE) const noexcept {
+            workspace &ws = IN_WORKSPACE;
+            const std::size_t m = ws.constraint_residuals.size();
+            constexpr std::size_t n = sizeof...(argType);
+            auto &a = ws.constraint_system;
+            auto &b = ws.constraint_multipliers;
+            a.assign(m * m, returnType{});
+            for (std::size_t r = 0; r < m; ++r) {
+                for (std::size_t c = 0; c < m; ++c) {
+                    for (std::size_t k = 0; k < n; ++k) {a[r * m + c] += ws.constraint_jacobian[r * n + k] * ws.preconditioner[k] * ws.constraint_jacobian[c * n + k];}
+                }
+            }
+            for (std::size_t col = 0; col < m; ++col) {
+                std::size_t pivot = col;
+                for (std::size_t r = col + 1; r < m; ++r) {
+                    if (std::abs(a[r * m + col]) > std::abs(a[pivot * m + col])) {pivot = r;}
+                }
+                if (!(std::abs(a[pivot * m + col]) > std::numeric_limits<returnType>::min()) || !std::isfinite(a[pivot * m + col])) {return false;}
+                if (pivot != col) {
+                    for (std::size_t c = 0; c < m; ++c) {std::swap(a[col * m + c], a[pivot * m + c]);}
+                    std::swap(b[col], b[pivot]);
+                }
+                for (std::size_t r = col + 1; r < m; ++r) {
+                    const returnType factor = a[r * m + col] / a[col * m + col];
+                    for (std::size_t c = col; c < m; ++c) {a[r * m + c] -= factor * a[col * m + c];}
+                    b[r] -= factor * b[col];
+                }
+            }
+            for (std::size_t r = m; r-- > 0;) {
+                for (std::size_t c = r + 1; c < m; ++c) {b[r] -= a[r * m + c] * b[c];}
+                b[r] /= a[r * m + r];
+            }
+            return true;
+        }
+
+        /**
+         * @brief Projects the derivatives onto the tangent space of the equality constraints at the optimal point.
+         *
+         * The projected derivatives g - J^T l, with (J P J^T) l = J P g, give a step -P (g - J^T l) along which the
+         * equality residuals do not change to first order.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         */
+        template <std::size_t... i>
+        void project_derivatives_onto_equalities (workspace &IN_WORKSPACE, std::index_sequence<i...>) const {
+            workspace &ws = IN_WORKSPACE;
+            constexpr std::size_t n = sizeof...(argType);
+            this->constraint_manager_->evaluate_equality_residuals(ws.optimal_point, ws.constraint_residuals);
+            this->get_constraint_jacobian(ws, ws.optimal_point, this->equality_residuals(), indices_for_args{});
+            const std::size_t m = ws.constraint_residuals.size();
+            ws.constraint_multipliers.assign(m, returnType{});
+            for (std::size_t e = 0; e < m; ++e) {
+                ((ws.constraint_multipliers[e] += ws.constraint_jacobian[e * n + i] * ws.preconditioner[i] * std::get<i>(ws.derivatives)),...);
+            }
+            if (!this->solve_projection_system(ws)) {return;}
+            for (std::size_t e = 0; e < m; ++e) {
+                ((std::get<i>(ws.derivatives) -= ws.constraint_jacobian[e * n + i] * ws.constraint_multipliers[e]),...);
+            }
+        }
+
+        /**
+         * @brief Returns a point to the equality constraints by Gauss-Newton iterations on their residuals.
+         *
+         * Every iteration takes the minimum-norm correction dx = -P J^T (J P J^T)^-1 r in the metric of the
+         * preconditioner P, with J from forward differences, and projects the result onto the bounds. The iterations
+         * stop once every residual is within its tolerance, after set_equality_projection_iterations() iterations,
+         * or when the correction no longer moves the point.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The point, projected in place.
+         * @return True if the point was moved.
+         */
+        template <std::size_t... i>
+        bool restore_equalities (workspace &IN_WORKSPACE, std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) const {
+            workspace &ws = IN_WORKSPACE;
+            this->constraint_manager_->equality_tolerances(ws.constraint_tolerances);
+            bool moved = false;
+            for (std::size_t iteration = 0; iteration < this->equality_projection_iterations; ++iteration) {
+                this->constraint_manager_->evaluate_equality_residuals(IN_POINT, ws.constraint_residuals);
+                const std::size_t m = ws.constraint_residuals.size();
+                bool satisfied = true;
+                for (std::size_t e = 0; e < m; ++e) {satisfied = satisfied && std::abs(ws.constraint_residuals[e]) <= ws.constraint_tolerances[e];}
+                if (satisfied) {break;}
+
+                this->get_constraint_jacobian(ws, IN_POINT, this->equality_residuals(), indices_for_args{});
+                if (!this->step_onto_constraints(ws, IN_POINT, indices_for_args{})) {break;}
+                moved = true;
+            }
+            return moved;
+        }
+
+        /**
+         * @brief Moves a point onto its violated constraints by Gauss-Newton iterations, without calling the
+         * objective function (see toggle_feasibility_restoration()).
+         *
+         * Every iteration collects the violated constraints, drives their residuals to zero with the same
+         * minimum-norm correction as restore_equalities() (inequality constraints to a point just inside their
+         * boundary), and stops once no constraint is violated, after
+         * set_feasibility_restoration_iterations() iterations, or when the correction no longer moves the point.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The point, restored in place.
+         * @return True if the point was moved.
+         */
+        template <std::size_t... i>
+        bool restore_feasibility (workspace &IN_WORKSPACE, std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) const {
+            workspace &ws = IN_WORKSPACE;
+            auto violated_residuals = [this, &ws] (const std::tuple<argType...> &IN_ARGS, std::vector<returnType> &OUT_RESIDUALS) {
+                this->constraint_manager_->evaluate_residuals(IN_ARGS, ws.constraint_values);
+                OUT_RESIDUALS.resize(ws.constraint_rows.size());
+                for (std::size_t r = 0; r < ws.constraint_rows.size(); ++r) {OUT_RESIDUALS[r] = ws.constraint_values[ws.constraint_rows[r]];}
+            };
+            bool moved = false;
+            for (std::size_t iteration = 0; iteration < this->feasibility_restoration_iterations; ++iteration) {
+                this->constraint_manager_->evaluate_residuals(IN_POINT, ws.constraint_values);
+                ws.constraint_rows.clear();
+                for (std::size_t c = 0; c < ws.constraint_values.size(); ++c) {
+                    if (this->constraint_manager_->violates(c, ws.constraint_values[c])) {ws.constraint_rows.push_back(c);}
+                }
+                if (ws.constraint_rows.empty()) {break;}
+
+                ws.constraint_residuals.resize(ws.constraint_rows.size());
+                for (std::size_t r = 0; r < ws.constraint_rows.size(); ++r) {ws.constraint_residuals[r] = ws.constraint_values[ws.constraint_rows[r]];}
+                this->get_constraint_jacobian(ws, IN_POINT, violated_residuals, indices_for_args{});
+                // aim inequality constraints inside their boundary by twice the change of a finite difference probe, so
+                // the derivatives of the main solve are not taken across it
+                for (std::size_t r = 0; r < ws.constraint_rows.size(); ++r) {
+                    if (this->constraint_manager_->is_equality(ws.constraint_rows[r])) {continue;}
+                    returnType margin = 0;
+                    ((margin += std::abs(ws.constraint_jacobian[r * sizeof...(argType) + i]) * this->finite_difference_step * std::max<returnType>(std::abs(std::get<i>(IN_POINT)), 1)),...);
+                    ws.constraint_residuals[r] += std::copysign(2 * margin, ws.constraint_residuals[r]);
+                }
+                if (!this->step_onto_constraints(ws, IN_POINT, indices_for_args{})) {break;}
+                moved = true;
+            }
+            return moved;
+        }
+
+        /**
+         * @brief Takes one Gauss-Newton step towards the constraints whose residuals and Jacobian are in the workspace.
+         *
+         * The step is the minimum-norm correction dx = -P J^T (J P J^T)^-1 r in the metric of the preconditioner P,
+         * projected onto the bounds.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The point, moved in place.
+         * @return True if the point was moved; false if the system is singular or the step does not move the point.
+         */
+        template <std::size_t... i>
+        bool step_onto_constraints (workspace &IN_WORKSPACE, std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) const {
+            workspace &ws = IN_WORKSPACE;
+            constexpr std::size_t n = sizeof...(argType);
+            ws.constraint_multipliers.assign(ws.constraint_residuals.begin(), ws.constraint_residuals.end());
+            if (!this->solve_projection_system(ws)) {return false;}
+            std::tuple<argType...> next = IN_POINT;
+            for (std::size_t e = 0; e < ws.constraint_residuals.size(); ++e) {
+                ((std::get<i>(next) -= ws.preconditioner[i] * ws.constraint_jacobian[e * n + i] * ws.constraint_multipliers[e]),...);
+            }
+            next = this->bounds_projection(std::move(next), indices_for_args{});
+            if (next == IN_POINT) {return false;}
+            IN_POINT = next;
+            return true;
+        }
+
+        /**
+         * @brief Projects a trial point of a step onto the bounds and, with the equality projection, back onto the
+         * equality constraints.
+         *
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The trial point.
+         * @return The projected trial point.
+         */
+        std::tuple<argType...> project_trial_point (workspace &IN_WORKSPACE, std::tuple<argType...> &&IN_POINT) const {
+            std::tuple<argType...> point = std::move(this->bounds_projection(std::move(IN_POINT), indices_for_args{}));
+            if (this->projects_equalities()) {this->restore_equalities(IN_WORKSPACE, point, indices_for_args{});}
+            return point;
+        }
+
+        /**
+         * @brief Calculates the norm of the gradient at the old optimal point, leaving out the components whose
+         * descent direction is blocked by an active bound.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @return The projected-gradient norm.
+         */
+        template <std::size_t... i>
+        returnType get_projected_gradient_norm (const workspace &IN_WORKSPACE, std::index_sequence<i...>) const noexcept {
+            return std::sqrt((returnType{0} + ... + this->get_projected_gradient_square<i>(IN_WORKSPACE)));
+        }
+
+        /**
+         * @brief Calculates the square of one projected-gradient component (zero if an active bound blocks it).
+         *
+         * @tparam i Index of the optimisation variable.
+         * @param IN_WORKSPACE The workspace of the solve.
+         */
+        template <std::size_t i>
+        returnType get_projected_gradient_square (const workspace &IN_WORKSPACE) const noexcept {
+            const auto &x = std::get<i>(IN_WORKSPACE.old_optimal_point);
+            const returnType g = std::get<i>(IN_WORKSPACE.derivatives);
+            if ((x <= std::get<i>(this->lower_bounds) && g > 0) || (x >= std::get<i>(this->upper_bounds) && g < 0)) {return 0;}
+            return g * g;
+        }
+
+        /**
+         * @brief Updates the diagonal preconditioner of the workspace after the derivatives are calculated.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         *
+         * @see set_variable_scaling()
+         */
+        template <std::size_t... i>
+        void update_preconditioner (workspace &IN_WORKSPACE, std::index_sequence<i...>) const noexcept {
+            workspace &ws = IN_WORKSPACE;
+            if (this->variable_scaling_ == gd::variable_scaling::bounds) {
+                ((ws.preconditioner[i] = (std::get<i>(this->upper_bounds) - std::get<i>(this->lower_bounds)) * (std::get<i>(this->upper_bounds) - std::get<i>(this->lower_bounds))),...);
+            } else if (this->variable_scaling_ == gd::variable_scaling::curvature) {
+                if (ws.previous_derivatives_valid) {
+                    (this->estimate_inverse_curvature<i>(ws),...);
+                }
+                ws.preconditioner = ws.inverse_curvature;
+                this->fill_unknown_factors(ws.preconditioner);
+            }
+        }
+
+        /**
+         * @brief Updates the inverse curvature estimate of one variable from the change of its derivative.
+         *
+         * The estimate is kept if the variable did not move or the secant curvature is not positive.
+         *
+         * @tparam i Index of the optimisation variable.
+         * @param IN_WORKSPACE The workspace of the solve.
+         */
+        template <std::size_t i>
+        void estimate_inverse_curvature (workspace &IN_WORKSPACE) const noexcept {
+            const returnType step = std::get<i>(IN_WORKSPACE.optimal_point) - std::get<i>(IN_WORKSPACE.previous_point);
+            const returnType change = std::get<i>(IN_WORKSPACE.derivatives) - std::get<i>(IN_WORKSPACE.previous_derivatives);
+            const returnType inverse = step / change;
+            if (step != 0 && std::isfinite(inverse) && inverse > 0) {IN_WORKSPACE.inverse_curvature[i] = inverse;}
+        }
+
+        /**
+         * @brief Replaces the preconditioner factors without an estimate (not positive) by the geometric mean of the
+         * estimated ones, or by 1 if there are none.
+         *
+         * @param IN_FACTORS The factors, completed in place.
+         */
+        static void fill_unknown_factors (std::array<returnType, sizeof...(argType)> &IN_FACTORS) noexcept {
+            returnType log_sum = 0;
+            std::size_t known = 0;
+            for (const auto &each : IN_FACTORS) {
+                if (each > 0) {log_sum += std::log(each); ++known;}
+            }
+            const returnType fill = known ? std::exp(log_sum / static_cast<returnType>(known)) : returnType{1};
+            for (auto &each : IN_FACTORS) {
+                if (!(each > 0)) {each = fill;}
+            }
+        }
+
         /**
          * @brief Creates the next point based on the current point and derivatives.
          *
@@ -953,12 +2841,13 @@ namespace gd {
          * and the derivatives. The new point is computed using the gradient descent update rule.
          *
          * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_POINT The current point.
          * @return The next point.
          */
         template <std::size_t... i>
-        std::tuple<argType...> create_next_point (const std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) noexcept {
-            return std::move(std::make_tuple((std::get<i>(IN_POINT) - std::get<i>(this->derivatives) * this->learning_rate * this->step_scales.at(i))...));
+        std::tuple<argType...> create_next_point (const workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) const noexcept {
+            return std::move(std::make_tuple((std::get<i>(IN_POINT) - std::get<i>(IN_WORKSPACE.derivatives) * IN_WORKSPACE.learning_rate * IN_WORKSPACE.step_scales.at(i) * IN_WORKSPACE.preconditioner[i])...));
         };
 
         /**
@@ -971,7 +2860,7 @@ namespace gd {
          * @param IN_FACTOR The scaling factor.
          * @return The scaled value.
          */
-        returnType scale_function (const returnType IN_X, const returnType IN_FACTOR) {
+        returnType scale_function (const returnType IN_X, const returnType IN_FACTOR) const {
             return std::sqrt(std::abs(IN_X / IN_FACTOR));
         }
 
@@ -983,64 +2872,179 @@ namespace gd {
          * magnitude and the highest derivative magnitude encountered so far.
          *
          * @tparam i Indices of elements in the array.
+         * @param IN_WORKSPACE The workspace of the solve.
          * @param IN_TO_SCALE Pointer to the array to be scaled.
          */
         template <std::size_t... i>
-        void scale (returnType* IN_TO_SCALE, std::index_sequence<i...>) {
-            if (!(this->first_iteration_settings)) {
-                ((*(IN_TO_SCALE + i) *= this->scale_function(std::get<i>(this->derivatives), std::get<i>(this->derivative_high))),...);
+        void scale (const workspace &IN_WORKSPACE, returnType* IN_TO_SCALE, std::index_sequence<i...>) const {
+            if (!(IN_WORKSPACE.first_iteration_settings)) {
+                ((*(IN_TO_SCALE + i) *= this->scale_function(std::get<i>(IN_WORKSPACE.derivatives), std::get<i>(IN_WORKSPACE.derivative_high))),...);
                 ((*(IN_TO_SCALE + i) = *(IN_TO_SCALE + i) < this->tolerance ? this->tolerance : *(IN_TO_SCALE + i)),...);
             }
         }
 
         /**
-         * @brief Computes the learning rate adjustment using the Secant Method.
+         * @brief Limits the learning rate to the last breakpoint of the projected path of the step.
+         *
+         * The breakpoint of a variable is the learning rate at which its coordinate hits the bound it moves towards;
+         * past the last one, every coordinate is clipped and the projected path stops moving.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve; its learning rate is limited.
+         * @param IN_POINT The start point of the step.
+         * @return False if the path does not move at all (or the step rounds to the start point); the workspace then
+         *         stays at the start point with a current tolerance of 0.
+         */
+        template <std::size_t... i>
+        bool clamp_to_projected_arc (workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, std::index_sequence<i...> i_seq) const noexcept {
+            returnType last_breakpoint = 0;
+            (this->update_last_breakpoint<i>(IN_WORKSPACE, IN_POINT, last_breakpoint),...);
+            if (last_breakpoint > 0) {
+                IN_WORKSPACE.learning_rate = std::min(IN_WORKSPACE.learning_rate, last_breakpoint);
+                if (this->bounds_projection(this->create_next_point(IN_WORKSPACE, IN_POINT, i_seq), i_seq) != IN_POINT) {return true;}
+            }
+            IN_WORKSPACE.optimal_point = IN_POINT;
+            IN_WORKSPACE.current_tolerance = 0;
+            return false;
+        }
+
+        /**
+         * @brief Raises the last breakpoint of the projected path to the breakpoint of one variable.
+         *
+         * @tparam i Index of the optimisation variable.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_POINT The start point of the step.
+         * @param OUT_LAST_BREAKPOINT The last breakpoint so far.
+         */
+        template <std::size_t i>
+        void update_last_breakpoint (const workspace &IN_WORKSPACE, const std::tuple<argType...> &IN_POINT, returnType &OUT_LAST_BREAKPOINT) const noexcept {
+            const returnType direction = IN_WORKSPACE.step_scales[i] * IN_WORKSPACE.preconditioner[i] * std::get<i>(IN_WORKSPACE.derivatives);
+            if (direction > 0) {
+                OUT_LAST_BREAKPOINT = std::max<returnType>(OUT_LAST_BREAKPOINT, (std::get<i>(IN_POINT) - std::get<i>(this->lower_bounds)) / direction);
+            } else if (direction < 0) {
+                OUT_LAST_BREAKPOINT = std::max<returnType>(OUT_LAST_BREAKPOINT, (std::get<i>(IN_POINT) - std::get<i>(this->upper_bounds)) / direction);
+            }
+        }
+
+        /**
+         * @brief Calculates the rate at which the objective function decreases along the step direction, per unit of
+         * learning rate.
+         *
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @return The sum of step scale * preconditioner * derivative^2 over the variables.
+         */
+        template <std::size_t... i>
+        returnType get_directional_slope (const workspace &IN_WORKSPACE, std::index_sequence<i...>) const noexcept {
+            return (returnType{0} + ... + (IN_WORKSPACE.step_scales[i] * IN_WORKSPACE.preconditioner[i] * std::get<i>(IN_WORKSPACE.derivatives) * std::get<i>(IN_WORKSPACE.derivatives)));
+        }
+
+        /**
+         * @brief Returns true if a step of the given learning rate from the old optimal point moves some variable by at
+         * least its finite difference spacing.
          *
-         * This method computes the adjustment of the learning rate using the Secant Method
-         * to optimise the gradient descent algorithm. It finds the learning rate which relates the
-         * derivative set space to the objective function variable set space. It iteratively calculates
-         * the new learning rate based on the current and previous learning rates, and the corresponding
-         * objective function values. The process continues until the convergence criterion is met or until
-         * the maximum number of iterations is reached.
+         * Shorter steps are below the resolution of the finite difference derivatives, so they cannot be trusted to
+         * lead downhill.
          *
-         * @param IN_CURRENT_VAL The current value of the objective function.
-         * @param IN_REQUIRED_VAL The required value of the objective function.
-         * @return The adjusted learning rate computed using the Secant Method.
+         * @tparam i Indices of elements in the tuples.
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_RATE The learning rate of the step.
+         */
+        template <std::size_t... i>
+        bool resolves_step (const workspace &IN_WORKSPACE, returnType IN_RATE, std::index_sequence<i...>) const noexcept {
+            return ((std::abs(IN_RATE * IN_WORKSPACE.step_scales[i] * IN_WORKSPACE.preconditioner[i] * std::get<i>(IN_WORKSPACE.derivatives)) >=
+                     this->finite_difference_step * IN_WORKSPACE.step_scales[i] * std::abs(std::get<i>(IN_WORKSPACE.old_optimal_point))) || ...);
+        }
+
+        /**
+         * @brief Computes the learning rate adjustment using a safeguarded (Illinois) secant method.
+         *
+         * This method computes the adjustment of the learning rate after a rejected step. It finds the mirror point:
+         * the point between the start of the step and the rejected trial point where the objective function returns
+         * to its value at the start of the step. Half of the distance to the mirror point is the
+         * minimiser of a quadratic along the line, which step_forward_with_secant_method() then steps to.
+         *
+         * @param IN_WORKSPACE The workspace of the solve.
+         * @param IN_CURRENT_VAL The value of the objective function at the rejected trial point minus the required
+         *                       value; it is reused as the bracket end at an adjustment of 0.
+         * @param IN_REQUIRED_VAL The required value of the objective function (its value at the start of the step).
+         * @param OUT_BEST_POINT The probed point with the lowest value, if it is lower than OUT_BEST_VAL on entry.
+         * @param OUT_BEST_VAL The value at OUT_BEST_POINT, so the caller does not evaluate a probed point twice.
+         * @return The adjustment of the learning rate, in (-learning_rate, 0) if the mirror point was found.
          *
          * @details
-         * The secant_learning_rate_scaling method adjusts the learning rate used in the gradient descent
-         * algorithm based on the Secant Method. It dynamically updates the learning rate to achieve convergence
-         * to the optimal solution. The method iteratively computes the new learning rate by interpolating between
-         * the current and previous learning rates, based on the corresponding objective function values. This process
-         * continues until the difference between successive learning rates falls below a predefined threshold or until
-         * the maximum number of iterations is reached.
+         * With h(r) the objective function at the step of learning rate + r from the start point (projected onto the
+         * bounds, like the trial point), minus the required value, h(0) = IN_CURRENT_VAL > 0 is already known. The
+         * method first brackets the mirror point with a point where h < 0, trying the minimiser of the quadratic
+         * through the start value, the directional derivative and the trial value first and then halving the step
+         * towards the start point until it no longer resolves (see resolves_step()). It then narrows the bracket with
+         * the Illinois variant of regula falsi: each iteration costs one evaluation, the root always stays bracketed
+         * (so the trivial root at the start point is never approached), and halving the value of an end point
+         * retained twice keeps the convergence superlinear. It stops once the bracket is within a relative tolerance
+         * of the step length.
          *
          * @note
          * <ul>
          * <li> This method is noexcept, ensuring that it does not throw exceptions.
-         * <li> The Secant Method is a root-finding algorithm used to approximate roots of a real-valued function.
-         * <li> The computed learning rate adjustment helps in optimising the gradient descent algorithm's convergence.
+         * <li> If no point below the required value is found (e.g. the finite difference derivatives do not point
+         * downhill), the shortest probed step is returned and OUT_BEST_VAL is left unchanged, so the caller can tell
+         * that no probe improved on the start point.
          * </ul>
          */
-        returnType secant_learning_rate_scaling (returnType IN_CURRENT_VAL, const returnType IN_REQUIRED_VAL) noexcept {
-
-            returnType current_rate = 0.0;
-            std::size_t iterative_count = 0;
+        returnType secant_learning_rate_scaling (workspace &IN_WORKSPACE, returnType IN_CURRENT_VAL, const returnType IN_REQUIRED_VAL, std::tuple<argType...> &OUT_BEST_POINT, returnType &OUT_BEST_VAL) const noexcept {
+            constexpr std::size_t bracket_max = 64;
             constexpr std::size_t iterative_max = 100;
-            returnType new_rate = current_rate - 0.5;
-            returnType new_val;
-            auto find_new_rate = [&new_rate, &current_rate, &new_val, &IN_CURRENT_VAL] () -> returnType {
-                return new_rate - new_val * (new_rate - current_rate) / (new_val - IN_CURRENT_VAL);
-            };
-            auto find_new_val = [&IN_REQUIRED_VAL, this] <std::size_t... i> (returnType &IN_RATE, std::index_sequence<i...>) {
-                return this->eval_func_at(std::make_tuple((std::get<i>(this->optimal_point) - IN_RATE * std::get<i>(this->step_scales) * std::get<i>(this->derivatives))...)) - IN_REQUIRED_VAL;
+            constexpr returnType relative_tolerance = 0.001;
+            const returnType rate = IN_WORKSPACE.learning_rate;
+            auto find_new_val = [&IN_REQUIRED_VAL, &IN_WORKSPACE, &rate, &OUT_BEST_POINT, &OUT_BEST_VAL, this] <std::size_t... i> (returnType IN_RATE, std::index_sequence<i...>) {
+                std::tuple<argType...> point = this->project_trial_point(IN_WORKSPACE, std::make_tuple((std::get<i>(IN_WORKSPACE.old_optimal_point) - (rate + IN_RATE) * std::get<i>(IN_WORKSPACE.step_scales) * std::get<i>(IN_WORKSPACE.preconditioner) * std::get<i>(IN_WORKSPACE.derivatives))...));
+                const returnType value = this->eval_func_at(IN_WORKSPACE, point);
+                if (value < OUT_BEST_VAL) {
+                    OUT_BEST_POINT = std::move(point);
+                    OUT_BEST_VAL = value;
+                }
+                return value - IN_REQUIRED_VAL;
             };
 
+            // bracket end with h > 0: the rejected trial point itself
+            returnType above_rate = 0.0;
+            returnType above_val = IN_CURRENT_VAL;
+            // bracket end with h < 0: start at the minimiser of the quadratic through the start value, its slope and the
+            // trial value, then halve the step towards the start point until the value drops below the required value
+            const returnType slope = -this->get_directional_slope(IN_WORKSPACE, indices_for_args{});
+            const returnType curvature = (IN_CURRENT_VAL - slope * rate) / (rate * rate);
+            const returnType minimiser = -slope / (2 * curvature);
+            returnType below_rate = 0.0;
+            returnType below_val = 0.0;
+            returnType step = (minimiser > 0 && minimiser < rate) ? 2 * minimiser : rate;
+            std::size_t bracket_count = 0;
             do {
-                new_val = find_new_val(new_rate, indices_for_args{});
-                current_rate = std::exchange(new_rate, find_new_rate());
-                IN_CURRENT_VAL = find_new_val(current_rate, indices_for_args {});
-            } while (std::abs(new_rate - current_rate) > 0.001 && iterative_count++ < iterative_max);
+                step *= 0.5;
+                below_rate = step - rate;
+                below_val = find_new_val(below_rate, indices_for_args{});
+            } while (!(below_val < 0) && ++bracket_count < bracket_max && this->resolves_step(IN_WORKSPACE, step, indices_for_args{}));
+            if (!(below_val < 0)) {return below_rate;}
+
+            returnType new_rate = below_rate;
+            int retained = 0;   // -1: the end below was retained last, +1: the end above was retained last
+            for (std::size_t iterative_count = 0; iterative_count < iterative_max; ++iterative_count) {
+                new_rate = (below_val * above_rate - above_val * below_rate) / (below_val - above_val);
+                const returnType new_val = find_new_val(new_rate, indices_for_args{});
+                if (new_val < 0) {
+                    below_rate = new_rate;
+                    below_val = new_val;
+                    if (retained == +1) {above_val *= 0.5;}
+                    retained = +1;
+                } else if (new_val > 0) {
+                    above_rate = new_rate;
+                    above_val = new_val;
+                    if (retained == -1) {below_val *= 0.5;}
+                    retained = -1;
+                } else {
+                    break;
+                }
+                if (std::abs(above_rate - below_rate) <= relative_tolerance * std::abs(rate + new_rate)) {break;}
+            }
             return new_rate;
         }
     };
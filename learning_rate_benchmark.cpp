@@ -0,0 +1,82 @@
+#define VERBOSITY 0
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gradient_decent.h"
+
+// Prints the objective evaluations every learning rate policy needs on a few bounded test problems, with the secant
+// method and with classic back-tracking ("-" where the solve fails). The last problem repeats the badly scaled one
+// with the bounds preconditioner (see gd::gradient_decent::set_variable_scaling()).
+
+double bivarient_function (const double x, const double y) noexcept {
+  constexpr double A = 10;
+  return (A * x * y) / (std::exp(x * x + y * y)) + (5.0/std::exp(1.0));
+}
+
+double anisotropic_quadratic (const double x, const double y) noexcept {
+  return (x - 1) * (x - 1) + 10 * (y - 0.5) * (y - 0.5) + 0.5;
+}
+
+double large_valued_quadratic (const double x, const double y) noexcept {
+  return 1e6 * ((x - 1) * (x - 1) + (y + 0.5) * (y + 0.5)) + 1e7;
+}
+
+double badly_scaled_quadratic (const double p, const double r) noexcept {
+  const double a = (p - 2e5) / 1e5;
+  return a * a + (r - 0.3) * (r - 0.3) + 1;
+}
+
+struct problem {
+  std::string name;
+  double (*function)(double, double);
+  std::tuple<double, double> guess;
+  std::tuple<double, double> lower;
+  std::tuple<double, double> upper;
+  gd::variable_scaling scaling = gd::variable_scaling::none;
+};
+
+std::string evaluations (const problem &IN_PROBLEM, const std::shared_ptr<const gd::learning_rate_policy<double>> &IN_POLICY, const bool classic) {
+  gd::gradient_decent<double, double, double> gradient_operator(IN_PROBLEM.function, std::get<0>(IN_PROBLEM.guess), std::get<1>(IN_PROBLEM.guess));
+  gradient_operator.add_lower_bounds(IN_PROBLEM.lower);
+  gradient_operator.add_upper_bounds(IN_PROBLEM.upper);
+  gradient_operator.set_tolerance(1e-5);
+  gradient_operator.set_variable_scaling(IN_PROBLEM.scaling);
+  if (IN_POLICY) gradient_operator.set_learning_rate_policy(IN_POLICY);
+  if (classic) gradient_operator.toggle_classic_gradient_algo();
+  try {
+    gradient_operator.perform_gradient_decent();
+  } catch (std::exception &) {
+    return "-";
+  }
+  return std::to_string(gradient_operator.get_func_call_count());
+}
+
+int main () {
+  const std::vector<problem> problems = {
+    {"example", bivarient_function, {1.6, -1.2}, {-2.0, -2.0}, {2.0, 2.0}},
+    {"anisotropic", anisotropic_quadratic, {1.8, 1.5}, {-2.0, -2.0}, {2.0, 2.0}},
+    {"large valued", large_valued_quadratic, {1.6, -1.2}, {-2.0, -2.0}, {2.0, 2.0}},
+    {"badly scaled", badly_scaled_quadratic, {1e5, 0.9}, {1e4, 0.01}, {5e5, 1.0}},
+    {"bounds scaled", badly_scaled_quadratic, {1e5, 0.9}, {1e4, 0.01}, {5e5, 1.0}, gd::variable_scaling::bounds},
+  };
+  const std::vector<std::pair<std::string, std::shared_ptr<const gd::learning_rate_policy<double>>>> policies = {
+    {"reset_on_new_high", nullptr},
+    {"rescale_on_new_high", std::make_shared<gd::rescale_on_new_high<double>>()},
+    {"armijo_memory", std::make_shared<gd::armijo_memory<double>>()},
+    {"barzilai_borwein", std::make_shared<gd::barzilai_borwein<double>>()},
+  };
+
+  for (const bool classic : {false, true}) {
+    std::printf("\n%s\n%-20s", classic ? "classic back-tracking" : "secant method", "");
+    for (const auto &each : problems) std::printf("%14s", each.name.c_str());
+    std::printf("\n");
+    for (const auto &[name, policy] : policies) {
+      std::printf("%-20s", name.c_str());
+      for (const auto &each : problems) std::printf("%14s", evaluations(each, policy, classic).c_str());
+      std::printf("\n");
+    }
+  }
+}
@@ -0,0 +1,180 @@
+/**
+ * @file learning_rate_policy.h
+ * @brief Header file containing the learning rate policies of gradient_decent.
+ *
+ * After the derivatives of an iteration are calculated, gradient_decent asks its learning rate policy for the
+ * learning rate to start the next step with. The default policy keeps the original behaviour (reset to 1 whenever a
+ * derivative exceeds its largest magnitude so far); the other policies keep what the previous steps learnt about the
+ * scale of the problem, so the secant and back-tracking searches do not have to rediscover it.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_LEARNING_RATE_POLICY_H
+#define CONCEPTUAL_LEARNING_RATE_POLICY_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+
+namespace gd {
+    /**
+     * @brief What a learning rate policy knows about the iteration that is about to step.
+     *
+     * @tparam returnType The type of the objective function's return value.
+     */
+    template <class returnType>
+    struct learning_rate_context {
+        returnType learning_rate {};        ///< The learning rate the previous step ended with.
+        bool first_iteration = false;       ///< True in the first iteration of a solve.
+        bool new_high = false;              ///< True if some derivative exceeded its largest magnitude so far.
+        returnType growth {1};              ///< The largest ratio of such a derivative to its previous largest magnitude (infinite if that was 0).
+        returnType step_dot_step {};        ///< s^T D^-1 s with s = x_k - x_k-1 and D the diagonal step metric (0 in the first iteration).
+        returnType step_dot_change {};      ///< s^T y with y = g_k - g_k-1 (0 in the first iteration).
+    };
+
+    /**
+     * @brief Interface of the learning rate policies.
+     *
+     * A policy is stateless: everything that changes during a solve is passed in the context, so one policy may be
+     * shared by every solve and thread.
+     *
+     * @tparam returnType The type of the objective function's return value.
+     */
+    template <class returnType>
+    class learning_rate_policy {
+    public:
+        virtual ~learning_rate_policy () = default;
+
+        /**
+         * @brief Returns the learning rate of the next step.
+         *
+         * @param IN_CONTEXT The state of the iteration.
+         */
+        [[nodiscard]] virtual returnType next (const learning_rate_context<returnType> &IN_CONTEXT) const = 0;
+
+        /**
+         * @brief Returns the name and parameters of the policy, used to tell problems apart in the result cache.
+         */
+        [[nodiscard]] virtual std::string describe () const = 0;
+    };
+
+    /**
+     * @brief The original policy: the learning rate is reset to 1 whenever a derivative exceeds its largest
+     * magnitude so far, and kept otherwise.
+     */
+    template <class returnType>
+    class reset_on_new_high : public learning_rate_policy<returnType> {
+    public:
+        [[nodiscard]] returnType next (const learning_rate_context<returnType> &IN_CONTEXT) const override {
+            return IN_CONTEXT.new_high ? returnType{1} : IN_CONTEXT.learning_rate;
+        }
+
+        [[nodiscard]] std::string describe () const override {
+            return "reset_on_new_high";
+        }
+    };
+
+    /**
+     * @brief Keep-and-rescale: when a derivative exceeds its largest magnitude so far by a factor r, the learning rate
+     * is divided by r, so the step keeps the length the previous searches found instead of restarting from 1.
+     *
+     * The first iteration, and derivatives that were 0 so far, fall back to a learning rate of 1.
+     */
+    template <class returnType>
+    class rescale_on_new_high : public learning_rate_policy<returnType> {
+    public:
+        [[nodiscard]] returnType next (const learning_rate_context<returnType> &IN_CONTEXT) const override {
+            if (!IN_CONTEXT.new_high) {return IN_CONTEXT.learning_rate;}
+            if (IN_CONTEXT.first_iteration || !std::isfinite(IN_CONTEXT.growth)) {return returnType{1};}
+            return IN_CONTEXT.learning_rate / IN_CONTEXT.growth;
+        }
+
+        [[nodiscard]] std::string describe () const override {
+            return "rescale_on_new_high";
+        }
+    };
+
+    /**
+     * @brief Armijo memory: every step starts from the learning rate the previous step was accepted with, so the
+     * line search continues from the scale it found instead of restarting from 1.
+     *
+     * A growth factor above 1 lets the learning rate recover after a region that needed short steps; keep it close
+     * to 1, since the back-tracking search shrinks the rate by only 1% per probe.
+     */
+    template <class returnType>
+    class armijo_memory : public learning_rate_policy<returnType> {
+    public:
+        /**
+         * @brief Constructs the policy.
+         *
+         * @param IN_GROWTH The factor the accepted learning rate is enlarged by (default: 1).
+         * @param IN_MAX_RATE The largest learning rate (default: unbounded).
+         */
+        explicit armijo_memory (returnType IN_GROWTH = 1, returnType IN_MAX_RATE = std::numeric_limits<returnType>::max()) noexcept
+            : growth(IN_GROWTH), max_rate(IN_MAX_RATE) {}
+
+        [[nodiscard]] returnType next (const learning_rate_context<returnType> &IN_CONTEXT) const override {
+            if (IN_CONTEXT.first_iteration) {return returnType{1};}
+            return std::min(IN_CONTEXT.learning_rate * this->growth, this->max_rate);
+        }
+
+        [[nodiscard]] std::string describe () const override {
+            std::ostringstream oss;
+            oss << "armijo_memory(" << this->growth << "," << this->max_rate << ")";
+            return oss.str();
+        }
+
+    private:
+        returnType growth;      ///< The factor the accepted learning rate is enlarged by.
+        returnType max_rate;    ///< The largest learning rate.
+    };
+
+    /**
+     * @brief Barzilai-Borwein: the learning rate is s^T D^-1 s / s^T y from the last step s and the change of the
+     * derivatives y, a scalar secant estimate of the inverse curvature along the path.
+     *
+     * Every step of gradient_decent is -learning rate * D * derivatives, where D is the diagonal of step scales
+     * (see gradient_decent::toggle_derivative_scaling()) times preconditioner (see
+     * gradient_decent::set_variable_scaling()), so the estimate is taken in the metric of D: it is the learning rate
+     * for which learning rate * D * y best matches s. The estimate is clamped to [min rate, max rate]. Where it is not
+     * available (first iteration, or a rejected step that did not move) or not positive (non-convex region), the
+     * policy falls back to the original behaviour.
+     */
+    template <class returnType>
+    class barzilai_borwein : public learning_rate_policy<returnType> {
+    public:
+        /**
+         * @brief Constructs the policy.
+         *
+         * @param IN_MIN_RATE The smallest learning rate (default: 1e-10).
+         * @param IN_MAX_RATE The largest learning rate (default: 1e10).
+         */
+        explicit barzilai_borwein (returnType IN_MIN_RATE = returnType(1e-10), returnType IN_MAX_RATE = returnType(1e10)) noexcept
+            : min_rate(IN_MIN_RATE), max_rate(IN_MAX_RATE) {}
+
+        [[nodiscard]] returnType next (const learning_rate_context<returnType> &IN_CONTEXT) const override {
+            const returnType rate = IN_CONTEXT.step_dot_step / IN_CONTEXT.step_dot_change;
+            if (!IN_CONTEXT.first_iteration && IN_CONTEXT.step_dot_step > 0 && IN_CONTEXT.step_dot_change > 0 && std::isfinite(rate)) {
+                return std::clamp(rate, this->min_rate, this->max_rate);
+            }
+            return IN_CONTEXT.new_high ? returnType{1} : IN_CONTEXT.learning_rate;
+        }
+
+        [[nodiscard]] std::string describe () const override {
+            std::ostringstream oss;
+            oss << "barzilai_borwein(" << this->min_rate << "," << this->max_rate << ")";
+            return oss.str();
+        }
+
+    private:
+        returnType min_rate;    ///< The smallest learning rate.
+        returnType max_rate;    ///< The largest learning rate.
+    };
+}
+
+
+#endif //CONCEPTUAL_LEARNING_RATE_POLICY_H
@@ -0,0 +1,152 @@
+/**
+ * @file mapped_file.h
+ * @brief Header file containing a small RAII wrapper around a POSIX memory-mapped file.
+ *
+ * The mapped file is used as the backing store for the persistent and cross-process caches of the
+ * optimiser. It creates (or opens) a file of a given size and maps it shared into the address space,
+ * so every process mapping the same path sees the same bytes.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_MAPPED_FILE_H
+#define CONCEPTUAL_MAPPED_FILE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aux {
+    /**
+     * @brief RAII wrapper for a shared, read-write memory-mapped file.
+     *
+     * The mapped_file class opens the file at the given path, grows it to the requested size if it is
+     * smaller (new bytes are zero-filled by the kernel) and maps it with MAP_SHARED. The mapping is
+     * released when the object is destroyed. The class is movable but not copyable.
+     *
+     * @note A runtime_error is thrown if the file cannot be opened, resized or mapped.
+     */
+    class mapped_file {
+    public:
+        /**
+         * @brief Default constructor. Constructs an empty (unmapped) object.
+         */
+        mapped_file () = default;
+
+        /**
+         * @brief Opens (or creates) and maps a file of the given size.
+         *
+         * @param IN_PATH The path of the backing file.
+         * @param IN_SIZE The size of the mapping in bytes.
+         */
+        mapped_file (const std::string &IN_PATH, std::size_t IN_SIZE) : length(IN_SIZE) {
+            const int fd = ::open(IN_PATH.c_str(), O_RDWR | O_CREAT, 0644);
+            if (fd < 0) {throw std::runtime_error("Cannot open mapped file: " + IN_PATH);}
+
+            struct stat info{};
+            if (::fstat(fd, &info) != 0 || (static_cast<std::size_t>(info.st_size) < IN_SIZE && ::ftruncate(fd, static_cast<off_t>(IN_SIZE)) != 0)) {
+                ::close(fd);
+                throw std::runtime_error("Cannot resize mapped file: " + IN_PATH);
+            }
+
+            void *address = ::mmap(nullptr, IN_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (address == MAP_FAILED) {throw std::runtime_error("Cannot map file: " + IN_PATH);}
+            this->address = static_cast<std::byte*>(address);
+        }
+
+        mapped_file (const mapped_file&) = delete;
+        mapped_file& operator= (const mapped_file&) = delete;
+
+        mapped_file (mapped_file &&IN_OTHER) noexcept :
+                address(std::exchange(IN_OTHER.address, nullptr)), length(std::exchange(IN_OTHER.length, 0)) {}
+
+        mapped_file& operator= (mapped_file &&IN_OTHER) noexcept {
+            if (this != &IN_OTHER) {
+                this->release();
+                this->address = std::exchange(IN_OTHER.address, nullptr);
+                this->length = std::exchange(IN_OTHER.length, 0);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Unmaps the file.
+         */
+        ~mapped_file () {
+            this->release();
+        }
+
+        /**
+         * @brief Returns the start of the mapping.
+         */
+        [[nodiscard]] std::byte* data () const noexcept {
+            return this->address;
+        }
+
+        /**
+         * @brief Returns the size of the mapping in bytes.
+         */
+        [[nodiscard]] std::size_t size () const noexcept {
+            return this->length;
+        }
+
+        /**
+         * @brief Flushes the mapping to the backing file.
+         */
+        void sync () const noexcept {
+            if (this->address != nullptr) {::msync(this->address, this->length, MS_ASYNC);}
+        }
+
+    private:
+        std::byte *address = nullptr;   ///< Start of the mapping.
+        std::size_t length = 0;         ///< Size of the mapping in bytes.
+
+        void release () noexcept {
+            if (this->address != nullptr) {::munmap(this->address, this->length);}
+            this->address = nullptr;
+            this->length = 0;
+        }
+    };
+
+    /**
+     * @brief Decides which process initialises the header of a shared file, identified by its magic word.
+     *
+     * The first process to swap the magic word from 0 (a new, zero-filled file) to IN_INITIALISING initialises the
+     * header and then stores the final magic word with release semantics. Every other process waits until the magic
+     * word changes. If it is still IN_INITIALISING after IN_TIMEOUT, the initialising process is taken to have died,
+     * and the waiting process initialises the header itself. The header is the only thing written before the magic
+     * word is published, so initialising it again is safe; several processes that take over at once write the same
+     * header for the same layout.
+     *
+     * @param IN_MAGIC The magic word at the start of the mapped file.
+     * @param IN_INITIALISING The value of the magic word while the header is being written.
+     * @param IN_TIMEOUT How long to wait for another process before taking over (default: 1 second).
+     * @return True if the caller must write the header and publish the magic word, false if it is already written.
+     */
+    inline bool claim_initialisation (std::uint64_t &IN_MAGIC, const std::uint64_t IN_INITIALISING, const std::chrono::milliseconds IN_TIMEOUT = std::chrono::seconds(1)) noexcept {
+        std::atomic_ref<std::uint64_t> magic(IN_MAGIC);
+        std::uint64_t expected = 0;
+        if (magic.compare_exchange_strong(expected, IN_INITIALISING, std::memory_order_acq_rel)) {return true;}
+        const auto deadline = std::chrono::steady_clock::now() + IN_TIMEOUT;
+        while (magic.load(std::memory_order_acquire) == IN_INITIALISING) {
+            if (std::chrono::steady_clock::now() >= deadline) {return true;}
+            std::this_thread::yield();
+        }
+        return false;
+    }
+}
+
+
+#endif //CONCEPTUAL_MAPPED_FILE_H
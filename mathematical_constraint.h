@@ -13,12 +13,22 @@
 #ifndef CONCEPTUAL_MATHEMATICAL_CONSTRAINT_H
 #define CONCEPTUAL_MATHEMATICAL_CONSTRAINT_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <span>
 #include <vector>
 #include <functional>
 #include <tuple>
 
-#include "unsupported/meta_types.h"
+#include "meta_types.h"
+#include "work_stealing_scheduler.h"
 
 namespace aux {
     /**
@@ -61,11 +71,21 @@ namespace aux {
              * @brief The tolerance for constraint violation.
              */
             float tolerance = 0.00001F;
+            /**
+             * @brief Relative evaluation cost of the constraint function; cheaper constraints are evaluated first.
+             */
+            float cost = 1.0F;
+            /**
+             * @brief Indices of the variables the constraint function reads (default: empty, i.e. every variable).
+             *
+             * Finite differences along a variable the constraint does not read reuse its value at the base point.
+             */
+            std::vector<std::size_t> dependencies;
 
             /**
              * @brief Constructor for creating a constraint.
              *
-             * Constructs a constraint with the provided function, operator, value, and tolerance.
+             * Constructs a constraint with the provided function, operator, value, tolerance and cost hint.
              *
              * @tparam constraintFuncTypes_ The decayed type of the constraint function.
              * @tparam operatorType_ The decayed type of the operator.
@@ -76,22 +96,49 @@ namespace aux {
              * @param IN_OPERATOR The operator used for the constraint.
              * @param IN_VALUE The value against which the constraint is evaluated.
              * @param IN_TOLERANCE The tolerance for constraint violation.
+             * @param IN_COST The relative evaluation cost of the constraint function (default: 1.0).
              *
              * @code{.cpp}
              * // example
              * auto constraint1_ = aux::constraints_system<returnType, argsType...>::create_constraint<decltype(constraint_function_1), double>(constraint_function_1, "&#x3C;", 9.0, 0.001f);
+             * // example: an expensive simulation, evaluated after the cheap constraints
+             * auto constraint2_ = aux::constraints_system<returnType, argsType...>::create_constraint<decltype(simulation), double>(simulation, "&#x3C;", 1.0, 0.001f, 100.0f);
              * @endcode
              */
             template <class constraintFuncTypes_, class operatorType_, class valueType_, class toleranceType_>
             requires (meta_types::check_func_v<valueType_, constraintFuncTypes_, argsType...> && meta_types::is_string_v<operatorType_> && std::is_floating_point_v<toleranceType_>)
-            create_constraint (constraintFuncTypes_&& IN_FUNC, operatorType_&& IN_OPERATOR, valueType_&& IN_VALUE, toleranceType_&& IN_TOLERANCE) {
+            create_constraint (constraintFuncTypes_&& IN_FUNC, operatorType_&& IN_OPERATOR, valueType_&& IN_VALUE, toleranceType_&& IN_TOLERANCE, float IN_COST = 1.0F) {
                 this->func = std::forward<constraintFuncTypes_>(IN_FUNC);
                 this->operator_ = std::forward<operatorType_>(IN_OPERATOR);
                 this->value = std::forward<valueType_>(IN_VALUE);
                 this->tolerance = std::forward<toleranceType_>(IN_TOLERANCE);
+                this->cost = IN_COST;
             };
         };
 
+        /**
+         * @brief Calculates constraint violation.
+         *
+         * Calculates the violation of a constraint based on obtained and required values,
+         * operator, and tolerance.
+         *
+         * @param IN_OBTAINED Obtained value.
+         * @param IN_REQUIRED Required value.
+         * @param IN_OPERATOR Constraint operator.
+         * @param IN_TOLERANCE Constraint tolerance.
+         * @return The violation value.
+         * */
+        static auto get_constraint_violation (const auto& IN_OBTAINED, const auto& IN_REQUIRED, const std::string& IN_OPERATOR, const auto& IN_TOLERANCE) {
+            std::remove_reference_t<std::decay_t<decltype(IN_REQUIRED)>> diff = IN_OBTAINED - IN_REQUIRED;
+            if (IN_OPERATOR == "<" && diff >= 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
+            if (IN_OPERATOR == "<=" && diff > 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
+            if (IN_OPERATOR == ">" && diff <= 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
+            if (IN_OPERATOR == ">=" && diff < 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
+            if (IN_OPERATOR == "=" && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
+            if (IN_OPERATOR == "!=" && std::abs(diff) < IN_TOLERANCE) {return std::numeric_limits<std::decay_t<decltype(IN_REQUIRED)>>::max();}
+            return decltype(IN_REQUIRED){};
+        }
+
         /**
          * @brief Abstract base class for managing mathematical constraints.
          *
@@ -109,6 +156,10 @@ namespace aux {
              * @brief Penalty associated with constraint violations.
              */
             returnType penalty{};
+            /**
+             * @brief Flag indicating if equality ("=") constraints are enforced by projection and left out of the penalty.
+             */
+            bool equalities_projected = false;
 
 
             /**
@@ -136,6 +187,27 @@ namespace aux {
              */
             virtual void get_penalty (const std::tuple<argsType...> &IN_ARGS_TUPLE) = 0;
 
+            /**
+             * @brief Virtual function to calculate the penalty for constraint violations without modifying the manager.
+             *
+             * Unlike get_penalty(), this function returns the penalty instead of storing it in `penalty`, so it
+             * can be called concurrently from several threads.
+             *
+             * @param IN_ARGS_TUPLE The tuple containing input arguments for evaluating constraints.
+             * @param IN_CUTOFF Stop evaluating constraints once the penalty exceeds this value; the returned penalty
+             *                  then lies above the cutoff but may omit the constraints not evaluated yet.
+             * @param IN_SCHEDULER If not null, the constraints are evaluated concurrently on this scheduler.
+             * @return The penalty.
+             */
+            virtual returnType evaluate_penalty (const std::tuple<argsType...> &IN_ARGS_TUPLE, returnType IN_CUTOFF, aux::work_stealing_scheduler *IN_SCHEDULER) const = 0;
+
+            /**
+             * @brief Calculates the full penalty serially (see the overload above).
+             */
+            returnType evaluate_penalty (const std::tuple<argsType...> &IN_ARGS_TUPLE) const {
+                return this->evaluate_penalty(IN_ARGS_TUPLE, std::numeric_limits<returnType>::max(), nullptr);
+            }
+
             /**
              * @brief Virtual function to add tolerances for constraints.
              *
@@ -144,6 +216,92 @@ namespace aux {
              * @param IN_TOLERANCES The vector of tolerance values to be added.
              */
             virtual void add_tolerances (const std::vector<float>& IN_TOLERANCES) = 0;
+
+            /**
+             * @brief Virtual function to add evaluation cost hints for constraints.
+             *
+             * This function is used to set the order in which constraints are evaluated: cheapest first.
+             *
+             * @param IN_COSTS The vector of cost hints to be added.
+             */
+            virtual void add_costs (const std::vector<float>& IN_COSTS) = 0;
+
+            /**
+             * @brief Virtual function to add the variables every constraint reads.
+             *
+             * @param IN_DEPENDENCIES The variable indices of every constraint (empty for every variable).
+             */
+            virtual void add_dependencies (const std::vector<std::vector<std::size_t>>& IN_DEPENDENCIES) = 0;
+
+            /**
+             * @brief Returns true if any constraint reads fewer than all variables.
+             */
+            [[nodiscard]] virtual bool has_dependencies () const noexcept = 0;
+
+            /**
+             * @brief Evaluates the penalty of every constraint separately.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param OUT_PENALTIES Receives one penalty per constraint (resized to the number of constraints).
+             */
+            virtual void evaluate_penalties (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::vector<returnType> &OUT_PENALTIES) const = 0;
+
+            /**
+             * @brief Evaluates the penalty at a point that differs from a base point in one variable only.
+             *
+             * Constraints that do not read the variable are not evaluated; their penalty at the base point is reused.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param IN_VARIABLE The index of the variable in which the point differs from the base point.
+             * @param IN_PENALTIES The penalties at the base point (see evaluate_penalties()).
+             * @return The penalty.
+             */
+            virtual returnType evaluate_penalty_along (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::size_t IN_VARIABLE, const std::vector<returnType> &IN_PENALTIES) const = 0;
+
+            /**
+             * @brief Returns the number of equality ("=") constraints.
+             */
+            [[nodiscard]] virtual std::size_t equality_count () const noexcept = 0;
+
+            /**
+             * @brief Evaluates the residual (obtained minus required value) of every equality constraint.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param OUT_RESIDUALS Receives one residual per equality constraint, in declaration order.
+             */
+            virtual void evaluate_equality_residuals (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::vector<returnType> &OUT_RESIDUALS) const = 0;
+
+            /**
+             * @brief Returns the tolerances of the equality constraints.
+             *
+             * @param OUT_TOLERANCES Receives one tolerance per equality constraint, in declaration order.
+             */
+            virtual void equality_tolerances (std::vector<returnType> &OUT_TOLERANCES) const = 0;
+
+            /**
+             * @brief Evaluates the residual (obtained minus required value) of every constraint.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param OUT_RESIDUALS Receives one residual per constraint, in declaration order.
+             */
+            virtual void evaluate_residuals (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::vector<returnType> &OUT_RESIDUALS) const = 0;
+
+            /**
+             * @brief Returns true if a residual violates its constraint beyond the tolerance.
+             *
+             * "!=" constraints are never reported, since driving their residual to zero would violate them.
+             *
+             * @param IN_CONSTRAINT The index of the constraint.
+             * @param IN_RESIDUAL The residual of the constraint (see evaluate_residuals()).
+             */
+            [[nodiscard]] virtual bool violates (std::size_t IN_CONSTRAINT, returnType IN_RESIDUAL) const = 0;
+
+            /**
+             * @brief Returns true if a constraint is an equality ("=") constraint.
+             *
+             * @param IN_CONSTRAINT The index of the constraint.
+             */
+            [[nodiscard]] virtual bool is_equality (std::size_t IN_CONSTRAINT) const noexcept = 0;
         };
 
 
@@ -186,10 +344,13 @@ namespace aux {
             template <class constraintFuncType> using return_type_t = std::invoke_result_t<std::decay_t<constraintFuncType>, argsType...>;
 
             std::vector<std::function<void(argsType...)>> vector_of_constraints;
+            std::tuple<std::function<return_type_t<constraintFuncTypes>(argsType...)>...> functions;
             std::tuple<std::shared_ptr<return_type_t<constraintFuncTypes>>...> return_tuple{};
             std::tuple<return_type_t<constraintFuncTypes>...> constraint_values;
             std::vector<std::string>operators;
             std::vector<float>tolerances;
+            std::vector<std::size_t>order;      ///< Evaluation order of the constraints, cheapest first.
+            std::vector<std::bitset<sizeof...(argsType)>>dependencies;     ///< Variables read by every constraint.
             bool constraints_on = false;
             static constexpr std::size_t constraint_count = sizeof...(constraintFuncTypes);
 
@@ -216,10 +377,14 @@ namespace aux {
                         this->vector_of_constraints.push_back(constraint_at);
                     };
                     (create_at.template operator()<i>(IN_FUNCS), ...);
+                    ((std::get<i>(this->functions) = IN_FUNCS), ...);
                 };
                 create(std::index_sequence_for<constraintFuncTypes...>{});
 
                 this->add_constraint_values(std::forward<valueTypes>(IN_VALUES)...);
+                this->order.resize(constraint_count);
+                std::iota(this->order.begin(), this->order.end(), std::size_t{0});
+                this->dependencies.assign(constraint_count, std::bitset<sizeof...(argsType)>{}.set());
             }
 
             /**
@@ -290,26 +455,54 @@ namespace aux {
             }
 
             /**
-             * @brief Calculates constraint violation.
+             * @brief Adds evaluation cost hints to the manager.
              *
-             * Calculates the violation of a constraint based on obtained and required values,
-             * operator, and tolerance.
+             * Sorts the evaluation order by cost (stable, so equal costs keep the declaration order).
+             *
+             * @param IN_COSTS Vector of cost hints.
+             */
+            void add_costs (const std::vector<float> &IN_COSTS) override {
+                const std::size_t size = sizeof...(constraintFuncTypes);
+                try {
+                    if (size != IN_COSTS.size()) {throw std::runtime_error("Length of cost vector does not match number of constraints");}
+                    std::iota(this->order.begin(), this->order.end(), std::size_t{0});
+                    std::stable_sort(this->order.begin(), this->order.end(), [&IN_COSTS] (std::size_t IN_FIRST, std::size_t IN_SECOND) {return IN_COSTS[IN_FIRST] < IN_COSTS[IN_SECOND];});
+                } catch (std::exception &e) {
+                    std::cerr << e.what() << std::endl;
+                    std::cerr << "Evaluating constraints in declaration order" << std::endl;
+                    std::iota(this->order.begin(), this->order.end(), std::size_t{0});
+                }
+            }
+
+            /**
+             * @brief Adds the variables every constraint reads to the manager.
              *
-             * @param IN_OBTAINED Obtained value.
-             * @param IN_REQUIRED Required value.
-             * @param IN_OPERATOR Constraint operator.
-             * @param IN_TOLERANCE Constraint tolerance.
-             * @return The violation value.
-             * */
-            auto get_constraint_violation (const auto& IN_OBTAINED, const auto& IN_REQUIRED, const std::string& IN_OPERATOR, const auto& IN_TOLERANCE) {
-                std::remove_reference_t<std::decay_t<decltype(IN_REQUIRED)>> diff = IN_OBTAINED - IN_REQUIRED;
-                if (IN_OPERATOR == "<" && diff >= 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
-                if (IN_OPERATOR == "<=" && diff > 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
-                if (IN_OPERATOR == ">" && diff <= 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
-                if (IN_OPERATOR == ">=" && diff < 0 && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
-                if (IN_OPERATOR == "=" && std::abs(diff) > IN_TOLERANCE) {return std::abs(diff);}
-                if (IN_OPERATOR == "!=" && std::abs(diff) < IN_TOLERANCE) {return std::numeric_limits<std::decay_t<decltype(IN_REQUIRED)>>::max();}
-                return decltype(IN_REQUIRED){};
+             * @param IN_DEPENDENCIES Vector of variable indices per constraint; an empty vector means every variable.
+             */
+            void add_dependencies (const std::vector<std::vector<std::size_t>> &IN_DEPENDENCIES) override {
+                const std::size_t size = sizeof...(constraintFuncTypes);
+                try {
+                    if (size != IN_DEPENDENCIES.size()) {throw std::runtime_error("Length of dependency vector does not match number of constraints");}
+                    for (std::size_t c = 0; c < size; ++c) {
+                        if (IN_DEPENDENCIES[c].empty()) {
+                            this->dependencies[c].set();
+                            continue;
+                        }
+                        this->dependencies[c].reset();
+                        for (const std::size_t variable : IN_DEPENDENCIES[c]) {this->dependencies[c].set(variable);}
+                    }
+                } catch (std::exception &e) {
+                    std::cerr << e.what() << std::endl;
+                    std::cerr << "Declaring every constraint dependent on every variable" << std::endl;
+                    this->dependencies.assign(size, std::bitset<sizeof...(argsType)>{}.set());
+                }
+            }
+
+            /**
+             * @brief Returns true if any constraint reads fewer than all variables.
+             */
+            [[nodiscard]] bool has_dependencies () const noexcept override {
+                return std::any_of(this->dependencies.begin(), this->dependencies.end(), [] (const auto &IN_MASK) {return !IN_MASK.all();});
             }
 
             /**
@@ -328,9 +521,10 @@ namespace aux {
 
                     auto get_penalty_ = [this] <std::size_t... i> (std::index_sequence<i...>) {
                         auto get_penalty_at = [this] <std::size_t i_> () {
+                            if (this->equalities_projected && this->operators[i_] == "=") {return;}
                             auto obt_value_at = *(std::get<i_>(this->return_tuple));
                             auto req_value_at = std::get<i_>(this->constraint_values);
-                            this->penalty += static_cast<returnType>(this->get_constraint_violation(obt_value_at, req_value_at, this->operators[i_], this->tolerances[i_]));
+                            this->penalty += static_cast<returnType>(get_constraint_violation(obt_value_at, req_value_at, this->operators[i_], this->tolerances[i_]));
                         };
                         (get_penalty_at.template operator()<i>(),...);
                     };
@@ -343,6 +537,293 @@ namespace aux {
                     this->penalty = {};
                 }
             }
+
+            using base_type = constraint_manager_base;
+            using base_type::evaluate_penalty;
+
+            /**
+             * @brief Calculates penalty for constraint violation without modifying the manager.
+             *
+             * Same penalty as get_penalty(), but the constraint values are kept on the stack instead of in the
+             * shared return pointers, so concurrent solves can share one manager.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param IN_CUTOFF Short-circuit threshold: constraints not started once the penalty exceeds it are skipped.
+             * @param IN_SCHEDULER If not null, independent constraints are evaluated concurrently on it.
+             * @return The penalty.
+             *
+             * @details
+             * Serially, the constraints are evaluated cheapest first (see add_costs()) and the loop stops as soon as
+             * the penalty exceeds the cutoff. Concurrently, every constraint is a task, started cheapest first; tasks
+             * that start after the cutoff was exceeded return immediately. Either way the returned penalty is exact
+             * if it does not exceed the cutoff, and is summed in the serial evaluation order, so without a cutoff the
+             * concurrent penalty is bit-for-bit the serial one.
+             */
+            returnType evaluate_penalty (const std::tuple<argsType...> &IN_ARGS_TUPLE, returnType IN_CUTOFF, aux::work_stealing_scheduler *IN_SCHEDULER) const override {
+                try {
+                    constexpr auto table = penalty_table(std::index_sequence_for<constraintFuncTypes...>{});
+                    returnType penalty_ = {};
+                    if (IN_SCHEDULER == nullptr || constraint_count < 2) {
+                        for (const std::size_t i : this->order) {
+                            penalty_ += table[i](*this, IN_ARGS_TUPLE);
+                            if (penalty_ > IN_CUTOFF) {break;}
+                        }
+                        return penalty_;
+                    }
+
+                    // Partial sums in completion order only drive the cutoff; the result is summed in evaluation order
+                    std::array<returnType, constraint_count> penalties {};
+                    std::mutex penalty_mutex;
+                    std::atomic<bool> exceeded = false;
+                    aux::parallel_for(*IN_SCHEDULER, constraint_count, [this, &table, &IN_ARGS_TUPLE, &penalties, &penalty_, &penalty_mutex, &exceeded, IN_CUTOFF] (std::size_t IN_INDEX) {
+                        if (exceeded.load(std::memory_order_relaxed)) {return;}
+                        penalties[IN_INDEX] = table[this->order[IN_INDEX]](*this, IN_ARGS_TUPLE);
+                        std::lock_guard lock(penalty_mutex);
+                        penalty_ += penalties[IN_INDEX];
+                        if (penalty_ > IN_CUTOFF) {exceeded.store(true, std::memory_order_relaxed);}
+                    });
+                    return std::accumulate(penalties.begin(), penalties.end(), returnType{});
+                } catch (std::exception &e) {
+                    std::cerr << "Error while calculating constraint penalty..." << e.what() << std::endl;
+                    std::cerr << "Ignoring constraints for current generation..." << std::endl;
+                    return {};
+                }
+            }
+
+            /**
+             * @brief Evaluates the penalty of every constraint separately.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param OUT_PENALTIES Receives one penalty per constraint; zeros if a constraint throws.
+             */
+            void evaluate_penalties (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::vector<returnType> &OUT_PENALTIES) const override {
+                constexpr auto table = penalty_table(std::index_sequence_for<constraintFuncTypes...>{});
+                OUT_PENALTIES.resize(constraint_count);
+                try {
+                    for (std::size_t c = 0; c < constraint_count; ++c) {OUT_PENALTIES[c] = table[c](*this, IN_ARGS_TUPLE);}
+                } catch (std::exception &e) {
+                    std::cerr << "Error while calculating constraint penalty..." << e.what() << std::endl;
+                    std::cerr << "Ignoring constraints for current generation..." << std::endl;
+                    std::fill(OUT_PENALTIES.begin(), OUT_PENALTIES.end(), returnType{});
+                }
+            }
+
+            /**
+             * @brief Evaluates the penalty at a point that differs from a base point in one variable only.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param IN_VARIABLE The index of the variable in which the point differs from the base point.
+             * @param IN_PENALTIES The penalties at the base point (see evaluate_penalties()).
+             * @return The penalty.
+             */
+            returnType evaluate_penalty_along (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::size_t IN_VARIABLE, const std::vector<returnType> &IN_PENALTIES) const override {
+                constexpr auto table = penalty_table(std::index_sequence_for<constraintFuncTypes...>{});
+                try {
+                    returnType penalty_ = {};
+                    for (std::size_t c = 0; c < constraint_count; ++c) {
+                        penalty_ += this->dependencies[c].test(IN_VARIABLE) ? table[c](*this, IN_ARGS_TUPLE) : IN_PENALTIES[c];
+                    }
+                    return penalty_;
+                } catch (std::exception &e) {
+                    std::cerr << "Error while calculating constraint penalty..." << e.what() << std::endl;
+                    std::cerr << "Ignoring constraints for current generation..." << std::endl;
+                    return {};
+                }
+            }
+
+            /**
+             * @brief Returns the number of equality ("=") constraints.
+             */
+            [[nodiscard]] std::size_t equality_count () const noexcept override {
+                return static_cast<std::size_t>(std::count(this->operators.begin(), this->operators.end(), "="));
+            }
+
+            /**
+             * @brief Evaluates the residual (obtained minus required value) of every equality constraint.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param OUT_RESIDUALS Receives one residual per equality constraint; zeros if a constraint throws.
+             */
+            void evaluate_equality_residuals (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::vector<returnType> &OUT_RESIDUALS) const override {
+                constexpr auto table = residual_table(std::index_sequence_for<constraintFuncTypes...>{});
+                OUT_RESIDUALS.resize(this->equality_count());
+                try {
+                    std::size_t e = 0;
+                    for (std::size_t c = 0; c < constraint_count; ++c) {
+                        if (this->operators[c] == "=") {OUT_RESIDUALS[e++] = table[c](*this, IN_ARGS_TUPLE);}
+                    }
+                } catch (std::exception &e) {
+                    std::cerr << "Error while calculating constraint residual..." << e.what() << std::endl;
+                    std::fill(OUT_RESIDUALS.begin(), OUT_RESIDUALS.end(), returnType{});
+                }
+            }
+
+            /**
+             * @brief Returns the tolerances of the equality constraints.
+             *
+             * @param OUT_TOLERANCES Receives one tolerance per equality constraint, in declaration order.
+             */
+            void equality_tolerances (std::vector<returnType> &OUT_TOLERANCES) const override {
+                OUT_TOLERANCES.clear();
+                for (std::size_t c = 0; c < constraint_count; ++c) {
+                    if (this->operators[c] == "=") {OUT_TOLERANCES.push_back(static_cast<returnType>(this->tolerances[c]));}
+                }
+            }
+
+            /**
+             * @brief Evaluates the residual (obtained minus required value) of every constraint.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @param OUT_RESIDUALS Receives one residual per constraint; zeros if a constraint throws.
+             */
+            void evaluate_residuals (const std::tuple<argsType...> &IN_ARGS_TUPLE, std::vector<returnType> &OUT_RESIDUALS) const override {
+                constexpr auto table = residual_table(std::index_sequence_for<constraintFuncTypes...>{});
+                OUT_RESIDUALS.resize(constraint_count);
+                try {
+                    for (std::size_t c = 0; c < constraint_count; ++c) {OUT_RESIDUALS[c] = table[c](*this, IN_ARGS_TUPLE);}
+                } catch (std::exception &e) {
+                    std::cerr << "Error while calculating constraint residual..." << e.what() << std::endl;
+                    std::fill(OUT_RESIDUALS.begin(), OUT_RESIDUALS.end(), returnType{});
+                }
+            }
+
+            /**
+             * @brief Returns true if a residual violates its constraint beyond the tolerance ("!=" excluded).
+             *
+             * @param IN_CONSTRAINT The index of the constraint.
+             * @param IN_RESIDUAL The residual of the constraint.
+             */
+            [[nodiscard]] bool violates (std::size_t IN_CONSTRAINT, returnType IN_RESIDUAL) const override {
+                if (this->operators[IN_CONSTRAINT] == "!=") {return false;}
+                return get_constraint_violation(IN_RESIDUAL, returnType{}, this->operators[IN_CONSTRAINT], static_cast<returnType>(this->tolerances[IN_CONSTRAINT])) != returnType{};
+            }
+
+            /**
+             * @brief Returns true if a constraint is an equality ("=") constraint.
+             *
+             * @param IN_CONSTRAINT The index of the constraint.
+             */
+            [[nodiscard]] bool is_equality (std::size_t IN_CONSTRAINT) const noexcept override {
+                return this->operators[IN_CONSTRAINT] == "=";
+            }
+
+        private:
+            using penalty_function = returnType (*) (const constraint_manager&, const std::tuple<argsType...>&);
+
+            /**
+             * @brief Returns the scaled violation of the i_-th constraint.
+             */
+            template <std::size_t i_>
+            static returnType penalty_at (const constraint_manager &IN_MANAGER, const std::tuple<argsType...> &IN_ARGS_TUPLE) {
+                if (IN_MANAGER.equalities_projected && IN_MANAGER.operators[i_] == "=") {return {};}
+                const float slope = 1000000000.0F;
+                auto obt_value_at = std::apply(std::get<i_>(IN_MANAGER.functions), IN_ARGS_TUPLE);
+                auto req_value_at = std::get<i_>(IN_MANAGER.constraint_values);
+                return slope * static_cast<returnType>(get_constraint_violation(obt_value_at, req_value_at, IN_MANAGER.operators[i_], IN_MANAGER.tolerances[i_]));
+            }
+
+            /**
+             * @brief Builds the table of per-constraint penalty functions, indexed by constraint.
+             */
+            template <std::size_t... i>
+            static constexpr std::array<penalty_function, constraint_count> penalty_table (std::index_sequence<i...>) {
+                return {&penalty_at<i>...};
+            }
+
+            /**
+             * @brief Returns the residual (obtained minus required value) of the i_-th constraint.
+             */
+            template <std::size_t i_>
+            static returnType residual_at (const constraint_manager &IN_MANAGER, const std::tuple<argsType...> &IN_ARGS_TUPLE) {
+                return static_cast<returnType>(std::apply(std::get<i_>(IN_MANAGER.functions), IN_ARGS_TUPLE) - std::get<i_>(IN_MANAGER.constraint_values));
+            }
+
+            /**
+             * @brief Builds the table of per-constraint residual functions, indexed by constraint.
+             */
+            template <std::size_t... i>
+            static constexpr std::array<penalty_function, constraint_count> residual_table (std::index_sequence<i...>) {
+                return {&residual_at<i>...};
+            }
+        };
+
+        /**
+         * @brief Objective function and constraints computed by one callable.
+         *
+         * When the objective value and every constraint value come out of the same expensive evaluation (e.g. one
+         * simulation run), the joint_evaluator calls a single function per point instead of the objective function
+         * and every constraint function separately. The function returns the objective value and writes the
+         * constraint values to the span it receives; the penalty is computed from the operators, values and
+         * tolerances exactly as the constraint_manager does.
+         *
+         * @code{.cpp}
+         * // example
+         * auto simulate = [] (double x, double y, std::span<double> OUT_CONSTRAINTS) -> double {
+         *     auto result = run_simulation(x, y);
+         *     OUT_CONSTRAINTS[0] = result.stress;
+         *     OUT_CONSTRAINTS[1] = result.mass;
+         *     return result.drag;
+         * };
+         * aux::constraints_system<double, double, double>::joint_evaluator evaluator(simulate, {"&#x3C;", "&#x3C;"}, {250.0, 12.0}, {0.001f, 0.001f});
+         * @endcode
+         *
+         * @note A runtime_error is thrown if the operators, values and tolerances differ in length.
+         */
+        struct joint_evaluator {
+            /**
+             * @brief The joint function: arguments, then the span receiving the constraint values.
+             */
+            std::function<returnType(argsType..., std::span<returnType>)> func;
+            std::vector<std::string> operators;
+            std::vector<returnType> values;
+            std::vector<float> tolerances;
+
+            /**
+             * @brief Constructor for the joint evaluator.
+             *
+             * @param IN_FUNC The joint function, returning the objective value and writing one value per constraint.
+             * @param IN_OPERATORS The operator of every constraint.
+             * @param IN_VALUES The value every constraint is evaluated against.
+             * @param IN_TOLERANCES The tolerance of every constraint.
+             */
+            template <class funcType>
+            joint_evaluator (funcType &&IN_FUNC, std::vector<std::string> IN_OPERATORS, std::vector<returnType> IN_VALUES, std::vector<float> IN_TOLERANCES)
+                    : func(std::forward<funcType>(IN_FUNC)), operators(std::move(IN_OPERATORS)), values(std::move(IN_VALUES)), tolerances(std::move(IN_TOLERANCES)) {
+                if (this->operators.size() != this->values.size() || this->tolerances.size() != this->values.size()) {
+                    std::cerr << "Joint evaluator has " << this->values.size() << " values, " << this->operators.size() << " operators and " << this->tolerances.size() << " tolerances" << std::endl;
+                    throw std::runtime_error("Length of operator, value and tolerance vectors do not match");
+                }
+            }
+
+            /**
+             * @brief Returns the number of constraints.
+             */
+            [[nodiscard]] std::size_t constraint_count () const noexcept {
+                return this->values.size();
+            }
+
+            /**
+             * @brief Evaluates the objective function and the constraint penalty with one call.
+             *
+             * @param IN_ARGS_TUPLE Tuple of input arguments.
+             * @return The objective value plus the constraint penalty.
+             *
+             * @note Safe to call concurrently if the joint function is; the constraint values are kept in a
+             * thread-local buffer, allocated once per thread.
+             */
+            returnType evaluate (const std::tuple<argsType...> &IN_ARGS_TUPLE) const {
+                thread_local std::vector<returnType> constraint_values;
+                constraint_values.assign(this->values.size(), returnType{});
+                const std::span<returnType> values_(constraint_values);
+                const returnType value = std::apply([this, &values_] (const argsType&... IN_ARGS) {return this->func(IN_ARGS..., values_);}, IN_ARGS_TUPLE);
+
+                const float slope = 1000000000.0F;
+                returnType penalty_ = {};
+                for (std::size_t i = 0; i < this->values.size(); ++i) {
+                    penalty_ += static_cast<returnType>(get_constraint_violation(constraint_values[i], this->values[i], this->operators[i], this->tolerances[i]));
+                }
+                return value + slope * penalty_;
+            }
         };
     };
 }
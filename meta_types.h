@@ -11,6 +11,7 @@
 
 #include <type_traits>
 #include <functional>
+#include <future>
 #include <string>
 #include <concepts>
 
@@ -45,6 +46,15 @@ namespace meta_types {
     template <class return_type, class func_type, class... args_type>
             static constexpr bool check_func_v = std::is_invocable_r_v<return_type, remove_all_qual<func_type>, args_type...>;
 
+    /**
+     * @brief Checks if a function of a specified type returns a std::future of the given return type.
+     *
+     * This trait checks if a function of a specified type, invoked with the given argument types, returns a value
+     * convertible to std::future<return_type>.
+     */
+    template <class return_type, class func_type, class... args_type>
+            static constexpr bool check_async_func_v = std::is_invocable_r_v<std::future<return_type>, remove_all_qual<func_type>, args_type...>;
+
     /**
      * @brief Provides the type of the ith argument in a tuple.
      *
@@ -53,6 +63,15 @@ namespace meta_types {
     template <std::size_t i, class tuple_type>
             using tuple_args_type_at = meta_types::remove_all_qual<std::tuple_element_t<i, meta_types::remove_all_qual<tuple_type>>>;
 
+    /**
+     * @brief Provides the return type of a function invoked with given argument types.
+     *
+     * This template alias provides the type returned by invoking a function of a specified type with the given
+     * argument types.
+     */
+    template <class funcType, class... argsType>
+            using return_type_t = std::invoke_result_t<remove_all_qual<funcType>, argsType...>;
+
     /**
      * @brief Creates a functional type from a given function type and argument types.
      *
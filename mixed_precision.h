@@ -0,0 +1,267 @@
+/**
+ * @file mixed_precision.h
+ * @brief Header file containing the mixed-precision mode: low-precision iterations with full-precision refinement.
+ *
+ * Most iterations of a solve are far from the optimum and do not need double precision. The
+ * mixed_precision_solver class runs the objective, derivatives and line search in the lower precision (float for
+ * double) until progress stalls near the resolution of that type, then refines the point in the full precision.
+ * Objectives that vectorise fit twice as many float lanes per SIMD register, and every phase moves half the data.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_MIXED_PRECISION_H
+#define CONCEPTUAL_MIXED_PRECISION_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "gradient_decent.h"
+
+namespace gd {
+    /**
+     * @brief The type the low-precision phase computes in: float for double, double for long double, the type
+     * itself otherwise.
+     */
+    template <class type>
+    struct lower_precision {
+        using type_ = type;
+    };
+
+    template <>
+    struct lower_precision<double> {
+        using type_ = float;
+    };
+
+    template <>
+    struct lower_precision<long double> {
+        using type_ = double;
+    };
+
+    template <class type>
+    using lower_precision_t = typename lower_precision<type>::type_;
+
+    /**
+     * @brief What the two phases of a mixed-precision solve did.
+     *
+     * @tparam returnType The type of the objective function's return value.
+     */
+    template <class returnType>
+    struct mixed_precision_report {
+        returnType low_precision_value {};                          ///< The optimal value of the low-precision phase, evaluated in the full precision.
+        std::size_t low_precision_calls = 0;                        ///< The objective calls of the low-precision phase.
+        gd::stop_reason low_precision_stop = gd::stop_reason::none; ///< Why the low-precision phase stopped (none if it failed).
+        double low_precision_seconds = 0;                           ///< The wall time of the low-precision phase.
+        returnType value {};                                        ///< The final optimal value.
+        std::size_t high_precision_calls = 0;                       ///< The objective calls of the refinement, including its start point.
+        gd::stop_reason high_precision_stop = gd::stop_reason::none;///< Why the refinement stopped.
+        double high_precision_seconds = 0;                          ///< The wall time of the refinement.
+
+        /**
+         * @brief Returns how much the refinement lowered the optimal value of the low-precision phase.
+         */
+        [[nodiscard]] returnType refinement_gain () const noexcept {
+            return this->low_precision_value - this->value;
+        }
+
+        /**
+         * @brief Returns the share of the objective calls that ran in the low precision.
+         */
+        [[nodiscard]] double low_precision_share () const noexcept {
+            const std::size_t calls = this->low_precision_calls + this->high_precision_calls;
+            return calls == 0 ? 0.0 : static_cast<double>(this->low_precision_calls) / static_cast<double>(calls);
+        }
+    };
+
+    /**
+     * @brief Gradient descent in two precisions: low-precision iterations, then full-precision refinement.
+     *
+     * The objective must be callable with both the full and the lower precision argument types, e.g. a function
+     * template or a generic lambda. The low-precision phase stops when the relative change of the optimal value, or
+     * its improvement over 3 iterations, falls below the switch threshold (by default 8 float epsilons). If that phase
+     * fails to converge, its last point is refined all the same; if its value is not finite, the refinement starts
+     * from the initial guess.
+     *
+     * Bounds, the tolerance and the maximum number of evaluations are set through this class; anything else (e.g.
+     * toggles or learning rate policies) is set on the phase solvers directly, see get_low_precision_solver() and
+     * get_high_precision_solver().
+     *
+     * @tparam returnType The type of the objective function's return value.
+     * @tparam argType The argument types of the objective function.
+     *
+     * @code{.cpp}
+     * // example
+     * auto objective = [] (auto x, auto y) {return (x - 1) * (x - 1) + 10 * (y - 0.5F) * (y - 0.5F) + 0.5F;};
+     * gd::mixed_precision_solver<double, double, double> solver(objective, 1.8, 1.5);
+     * solver.add_lower_bounds(std::make_tuple(-2.0, -2.0));
+     * solver.add_upper_bounds(std::make_tuple(2.0, 2.0));
+     * solver.set_tolerance(1e-8);
+     * auto [minimum_value, minimum_point] = solver.perform_gradient_decent();
+     * std::cout << solver.get_report().low_precision_share() << std::endl;
+     * @endcode
+     */
+    template <class returnType, class... argType>
+    class mixed_precision_solver {
+    public:
+        using low_precision_type = gd::lower_precision_t<returnType>;
+        using low_precision_solver = gd::gradient_decent<low_precision_type, gd::lower_precision_t<argType>...>;
+        using high_precision_solver = gd::gradient_decent<returnType, argType...>;
+
+        /**
+         * @brief Constructs the solver.
+         *
+         * @param IN_FUNC The objective function, callable in both precisions.
+         * @param IN_GUESS The initial guess.
+         */
+        template <class funcType>
+        requires (std::is_invocable_r_v<returnType, funcType&, argType...> &&
+                  std::is_invocable_r_v<low_precision_type, funcType&, gd::lower_precision_t<argType>...>)
+        explicit mixed_precision_solver (funcType &&IN_FUNC, argType... IN_GUESS) :
+                low_solver(IN_FUNC, static_cast<gd::lower_precision_t<argType>>(IN_GUESS)...),
+                high_solver(std::forward<funcType>(IN_FUNC), std::move(IN_GUESS)...) {
+            this->set_switch_threshold(8 * std::numeric_limits<low_precision_type>::epsilon());
+            VERBOSE_PRINT("Mixed Precision Gradient Decent instance created...");
+        }
+
+        /**
+         * @brief Sets the lower bounds of both phases.
+         *
+         * @param IN_LOWER_BOUNDS The lower bound of each optimisation variable.
+         */
+        void add_lower_bounds (const std::tuple<argType...> &IN_LOWER_BOUNDS) {
+            this->high_solver.add_lower_bounds(IN_LOWER_BOUNDS);
+            this->low_solver.add_lower_bounds(this->lower(IN_LOWER_BOUNDS, std::index_sequence_for<argType...>{}));
+            this->lower_bounds = IN_LOWER_BOUNDS;
+        }
+
+        /**
+         * @brief Sets the upper bounds of both phases.
+         *
+         * @param IN_UPPER_BOUNDS The upper bound of each optimisation variable.
+         */
+        void add_upper_bounds (const std::tuple<argType...> &IN_UPPER_BOUNDS) {
+            this->high_solver.add_upper_bounds(IN_UPPER_BOUNDS);
+            this->low_solver.add_upper_bounds(this->lower(IN_UPPER_BOUNDS, std::index_sequence_for<argType...>{}));
+            this->upper_bounds = IN_UPPER_BOUNDS;
+        }
+
+        /**
+         * @brief Sets the tolerance of the full-precision refinement.
+         */
+        void set_tolerance (returnType IN_TOLERANCE) noexcept {
+            this->high_solver.set_tolerance(IN_TOLERANCE);
+        }
+
+        /**
+         * @brief Sets the maximum number of evaluations of each phase.
+         */
+        void set_max_eval (std::size_t IN_MAX_EVAL) noexcept {
+            this->low_solver.set_max_eval(IN_MAX_EVAL);
+            this->high_solver.set_max_eval(IN_MAX_EVAL);
+        }
+
+        /**
+         * @brief Sets when the low-precision phase hands over to the refinement.
+         *
+         * @param IN_RELATIVE The relative change (per iteration, or over 3 iterations) of the optimal value below
+         * which the low-precision phase stops; replaces the convergence criteria of the low-precision solver.
+         */
+        void set_switch_threshold (low_precision_type IN_RELATIVE) {
+            gd::convergence_criteria<low_precision_type> criteria;
+            criteria.add_relative_change(IN_RELATIVE).add_stall(3, IN_RELATIVE);
+            this->low_solver.set_convergence_criteria(std::move(criteria));
+        }
+
+        /**
+         * @brief Returns the solver of the low-precision phase, for settings this class does not forward.
+         */
+        [[nodiscard]] low_precision_solver& get_low_precision_solver () noexcept {
+            return this->low_solver;
+        }
+
+        /**
+         * @brief Returns the solver of the full-precision refinement, for settings this class does not forward.
+         */
+        [[nodiscard]] high_precision_solver& get_high_precision_solver () noexcept {
+            return this->high_solver;
+        }
+
+        /**
+         * @brief Returns what the phases of the last solve did.
+         */
+        [[nodiscard]] const gd::mixed_precision_report<returnType>& get_report () const noexcept {
+            return this->report;
+        }
+
+        /**
+         * @brief Performs the low-precision phase and the full-precision refinement.
+         *
+         * @return A pair containing the optimal value and the optimal point of the refinement.
+         *
+         * @note A runtime_error is thrown if the refinement fails to converge.
+         */
+        std::pair<returnType, std::tuple<argType...>> perform_gradient_decent () {
+            using clock = std::chrono::steady_clock;
+            this->report = {};
+
+            auto start = clock::now();
+            auto low_ws = this->low_solver.make_workspace();
+            try {
+                this->low_solver.solve(low_ws);
+                this->report.low_precision_stop = low_ws.stopped_by;
+            } catch (std::exception &e) {
+                VERBOSE_PRINT("Low precision phase did not converge: " << e.what());
+            }
+            this->report.low_precision_calls = low_ws.func_call_count;
+            this->report.low_precision_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+            start = clock::now();
+            auto high_ws = std::isfinite(low_ws.optimal_val)
+                    ? this->high_solver.make_workspace(this->raise(low_ws.optimal_point, std::index_sequence_for<argType...>{}))
+                    : this->high_solver.make_workspace();
+            this->report.low_precision_value = high_ws.optimal_val;
+            VERBOSE_PRINT("Refining in full precision from optimal value: " << high_ws.optimal_val);
+            auto result = this->high_solver.solve(high_ws);
+            this->report.value = result.first;
+            this->report.high_precision_calls = high_ws.func_call_count;
+            this->report.high_precision_stop = high_ws.stopped_by;
+            this->report.high_precision_seconds = std::chrono::duration<double>(clock::now() - start).count();
+            return result;
+        }
+
+    private:
+        low_precision_solver low_solver;                        ///< The solver of the low-precision phase.
+        high_precision_solver high_solver;                      ///< The solver of the full-precision refinement.
+        std::optional<std::tuple<argType...>> lower_bounds;     ///< The lower bounds in the full precision.
+        std::optional<std::tuple<argType...>> upper_bounds;     ///< The upper bounds in the full precision.
+        gd::mixed_precision_report<returnType> report;          ///< What the phases of the last solve did.
+
+        template <std::size_t... i>
+        [[nodiscard]] static std::tuple<gd::lower_precision_t<argType>...> lower (const std::tuple<argType...> &IN_POINT, std::index_sequence<i...>) noexcept {
+            return std::make_tuple(static_cast<gd::lower_precision_t<argType>>(std::get<i>(IN_POINT))...);
+        }
+
+        /**
+         * @brief Converts a low-precision point to the full precision, clamped to the full-precision bounds (a bound
+         * rounded to the low precision may lie just outside the original).
+         */
+        template <std::size_t... i>
+        [[nodiscard]] std::tuple<argType...> raise (const std::tuple<gd::lower_precision_t<argType>...> &IN_POINT, std::index_sequence<i...>) const noexcept {
+            std::tuple<argType...> point {static_cast<argType>(std::get<i>(IN_POINT))...};
+            if (this->lower_bounds) {((std::get<i>(point) = std::max(std::get<i>(point), std::get<i>(*this->lower_bounds))),...);}
+            if (this->upper_bounds) {((std::get<i>(point) = std::min(std::get<i>(point), std::get<i>(*this->upper_bounds))),...);}
+            return point;
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_MIXED_PRECISION_H
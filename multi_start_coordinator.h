@@ -0,0 +1,515 @@
+/**
+ * @file multi_start_coordinator.h
+ * @brief Header file containing a coordinator and worker for distributed multi-start optimisation.
+ *
+ * One global search is spread over many worker processes (or machines). The coordinator hands out start
+ * points over a small socket protocol, collects the results and keeps the incumbent (best value found so far),
+ * which it broadcasts to the workers whenever it improves. Workers pick up the broadcasts while they optimise and
+ * prune starts whose trajectories are clearly dominated by the incumbent.
+ * The protocol runs over any stream socket; Unix domain sockets are used for local runs.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_MULTI_START_COORDINATOR_H
+#define CONCEPTUAL_MULTI_START_COORDINATOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <poll.h>
+
+#include "counter_rng.h"
+#include "gradient_decent.h"
+#include "unix_socket.h"
+
+namespace gd {
+    /**
+     * @brief Wire format of the multi-start coordinator.
+     *
+     * Every message is a message_header followed by `dimension` doubles (a start point or an optimal point).
+     * A worker sends `request_start` once after connecting and a `result` after every start; the coordinator
+     * answers both with the next `start` (carrying the incumbent value). Whenever a result improves the incumbent,
+     * the coordinator sends an `incumbent` message to every other worker, so workers never have to ask for it; they
+     * may still send `query_incumbent` at any time and receive an `incumbent` message. When the search ends, every
+     * connected worker receives `done`.
+     */
+    namespace multi_start_protocol {
+        constexpr std::uint32_t magic = 0x47444d53;    ///< "GDMS"
+        constexpr std::uint32_t max_dimension = 1U << 20;
+
+        /**
+         * @brief Message types.
+         */
+        enum type : std::uint32_t {
+            request_start = 1,      ///< Worker asks for its first start point.
+            result = 2,             ///< Worker reports the result of a start and asks for the next one.
+            query_incumbent = 3,    ///< Worker asks for the current incumbent value.
+            start = 4,              ///< Coordinator assigns a start point.
+            done = 5,               ///< Coordinator has no more start points.
+            incumbent = 6           ///< Coordinator reports the incumbent value.
+        };
+
+        /**
+         * @brief Result flags.
+         */
+        enum result_flags : std::uint32_t {
+            pruned = 1U << 0,       ///< The start was stopped because it was dominated by the incumbent.
+            failed = 1U << 1        ///< The optimisation threw (e.g. failed to converge).
+        };
+
+        struct message_header {
+            std::uint32_t magic = multi_start_protocol::magic;
+            std::uint32_t type = 0;
+            std::uint32_t dimension = 0;
+            std::uint32_t flags = 0;
+            std::uint64_t start_index = 0;
+            double value = std::numeric_limits<double>::infinity();
+        };
+
+        /**
+         * @brief Sends a message with an optional point.
+         */
+        inline bool send (int IN_FD, const message_header &IN_HEADER, const std::vector<double> &IN_POINT = {}) noexcept {
+            message_header header = IN_HEADER;
+            header.dimension = static_cast<std::uint32_t>(IN_POINT.size());
+            return aux::write_exact(IN_FD, &header, sizeof(header)) && aux::write_exact(IN_FD, IN_POINT.data(), IN_POINT.size() * sizeof(double));
+        }
+
+        /**
+         * @brief Takes the first complete message out of the bytes received so far.
+         *
+         * @param IN_OUT_BUFFER The received bytes; a complete message is erased from their front.
+         * @param OUT_HEADER The header of the message.
+         * @param OUT_POINT The point of the message.
+         * @param OUT_VALID Set to false if the message is malformed.
+         * @return True if a complete message was taken out.
+         */
+        inline bool decode (std::vector<char> &IN_OUT_BUFFER, message_header &OUT_HEADER, std::vector<double> &OUT_POINT, bool &OUT_VALID) {
+            if (IN_OUT_BUFFER.size() < sizeof(OUT_HEADER)) {return false;}
+            std::memcpy(&OUT_HEADER, IN_OUT_BUFFER.data(), sizeof(OUT_HEADER));
+            if (OUT_HEADER.magic != magic || OUT_HEADER.dimension > max_dimension) {
+                OUT_VALID = false;
+                return false;
+            }
+            const std::size_t size = sizeof(OUT_HEADER) + OUT_HEADER.dimension * sizeof(double);
+            if (IN_OUT_BUFFER.size() < size) {return false;}
+            OUT_POINT.resize(OUT_HEADER.dimension);
+            std::memcpy(OUT_POINT.data(), IN_OUT_BUFFER.data() + sizeof(OUT_HEADER), OUT_POINT.size() * sizeof(double));
+            IN_OUT_BUFFER.erase(IN_OUT_BUFFER.begin(), IN_OUT_BUFFER.begin() + static_cast<std::ptrdiff_t>(size));
+            return true;
+        }
+
+        /**
+         * @brief Receives a message and its point, waiting until it is complete.
+         *
+         * @param IN_FD The socket descriptor.
+         * @param IN_OUT_BUFFER The bytes received but not decoded yet; kept between calls.
+         * @param OUT_HEADER The header of the message.
+         * @param OUT_POINT The point of the message.
+         * @return False if the connection was closed or the message is malformed.
+         */
+        inline bool receive (int IN_FD, std::vector<char> &IN_OUT_BUFFER, message_header &OUT_HEADER, std::vector<double> &OUT_POINT) {
+            bool valid = true;
+            while (!decode(IN_OUT_BUFFER, OUT_HEADER, OUT_POINT, valid)) {
+                pollfd readable{IN_FD, POLLIN, 0};
+                if (!valid || (::poll(&readable, 1, -1) < 0 && errno != EINTR) || !aux::read_available(IN_FD, IN_OUT_BUFFER)) {return false;}
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief Outcome of a distributed multi-start search.
+     */
+    struct multi_start_result {
+        double value = std::numeric_limits<double>::infinity();    ///< Best (incumbent) value.
+        std::vector<double> point;                                  ///< Best (incumbent) point.
+        std::uint64_t start_index = 0;                              ///< Index of the start that produced the incumbent.
+        std::size_t completed = 0;                                  ///< Starts that ran to convergence.
+        std::size_t pruned = 0;                                     ///< Starts pruned as dominated.
+        std::size_t failed = 0;                                     ///< Starts whose optimisation threw.
+
+        /**
+         * @brief Returns true if at least one start converged.
+         */
+        [[nodiscard]] bool found () const noexcept {
+            return !this->point.empty();
+        }
+    };
+
+    /**
+     * @brief Coordinator of a distributed multi-start search.
+     *
+     * The multi_start_coordinator class owns the list of start points. serve() accepts workers, hands each of
+     * them one start at a time, collects the results and broadcasts every improvement of the incumbent until every
+     * start has been accounted for. Workers are read without blocking into a buffer each, so a slow worker never
+     * holds up the others. Starts held by a worker that disconnects are handed out again.
+     *
+     * @code{.cpp}
+     * // example
+     * auto starts = gd::multi_start_coordinator::uniform_starts({-2.0, -2.0}, {2.0, 2.0}, 64, 42);
+     * gd::multi_start_coordinator coordinator(std::move(starts));
+     * gd::multi_start_result best = coordinator.serve("/tmp/multi_start.sock");
+     * @endcode
+     */
+    class multi_start_coordinator {
+    public:
+        /**
+         * @brief Constructs the coordinator for the given start points.
+         *
+         * @param IN_STARTS The start points, all of the same dimension.
+         */
+        explicit multi_start_coordinator (std::vector<std::vector<double>> IN_STARTS) : starts(std::move(IN_STARTS)) {
+            if (::pipe(this->wake_pipe) != 0) {throw std::runtime_error("Cannot create coordinator wake-up pipe");}
+        }
+
+        multi_start_coordinator (const multi_start_coordinator&) = delete;
+        multi_start_coordinator& operator= (const multi_start_coordinator&) = delete;
+
+        ~multi_start_coordinator () {
+            ::close(this->wake_pipe[0]);
+            ::close(this->wake_pipe[1]);
+        }
+
+        /**
+         * @brief Generates start points uniformly distributed in a box.
+         *
+         * @param IN_LOWER The lower bounds of the box.
+         * @param IN_UPPER The upper bounds of the box.
+         * @param IN_COUNT The number of start points.
+         * @param IN_SEED The seed of the random number generator.
+         * @return The start points.
+         *
+         * @note The points come from a counter-based generator (see aux::counter_rng): point i, coordinate k is
+         * sample k of stream i, so the same seed gives the same points on every platform.
+         */
+        static std::vector<std::vector<double>> uniform_starts (const std::vector<double> &IN_LOWER, const std::vector<double> &IN_UPPER, std::size_t IN_COUNT, std::uint64_t IN_SEED) {
+            const aux::counter_rng generator(IN_SEED);
+            std::vector<std::vector<double>> points(IN_COUNT, std::vector<double>(IN_LOWER.size()));
+            for (std::size_t i = 0; i < points.size(); ++i) {
+                for (std::size_t k = 0; k < points[i].size(); ++k) {points[i][k] = IN_LOWER[k] + generator.uniform(i, k) * (IN_UPPER[k] - IN_LOWER[k]);}
+            }
+            return points;
+        }
+
+        /**
+         * @brief Serves workers on the given socket path until every start is accounted for or stop() is called.
+         *
+         * @param IN_PATH The Unix domain socket path. A stale socket file at this path is replaced.
+         * @return The incumbent and the counts of completed, pruned and failed starts.
+         */
+        multi_start_result serve (const std::string &IN_PATH) {
+            aux::socket_fd listener = aux::listen_unix(IN_PATH);
+            std::vector<std::unique_ptr<client>> clients;
+            std::deque<std::uint64_t> pending;
+            for (std::uint64_t i = 0; i < this->starts.size(); ++i) {pending.push_back(i);}
+            std::size_t finished = 0;
+            VERBOSE_PRINT("Multi-start coordinator listening on " << IN_PATH << " with " << this->starts.size() << " starts");
+
+            // Hands the next pending start to a waiting worker; parks the worker if none is pending.
+            auto assign = [this, &pending] (client &IN_CLIENT) -> bool {
+                if (pending.empty()) {
+                    IN_CLIENT.waiting = true;
+                    return true;
+                }
+                IN_CLIENT.waiting = false;
+                IN_CLIENT.assigned = pending.front();
+                pending.pop_front();
+                multi_start_protocol::message_header header;
+                header.type = multi_start_protocol::start;
+                header.start_index = *IN_CLIENT.assigned;
+                header.value = this->best.value;
+                return multi_start_protocol::send(IN_CLIENT.socket_.get(), header, this->starts[*IN_CLIENT.assigned]);
+            };
+
+            while (finished < this->starts.size() && !this->stop_requested) {
+                std::vector<pollfd> poll_set{{this->wake_pipe[0], POLLIN, 0}, {listener.get(), POLLIN, 0}};
+                for (const auto &each : clients) {poll_set.push_back({each->socket_.get(), POLLIN, 0});}
+                if (::poll(poll_set.data(), poll_set.size(), -1) < 0) {
+                    if (errno == EINTR) {continue;}
+                    break;
+                }
+                if (poll_set[0].revents != 0) {break;}
+                if ((poll_set[1].revents & POLLIN) != 0) {
+                    aux::socket_fd socket_(::accept(listener.get(), nullptr, nullptr));
+                    if (socket_.valid()) {clients.push_back(std::make_unique<client>(std::move(socket_)));}
+                }
+
+                // Answers one message of a worker; returns false if the worker has to be dropped.
+                auto handle = [this, &clients, &finished, &assign] (client &IN_CLIENT, const multi_start_protocol::message_header &IN_HEADER, std::vector<double> &&IN_POINT) -> bool {
+                    if (IN_HEADER.type == multi_start_protocol::query_incumbent) {
+                        multi_start_protocol::message_header reply;
+                        reply.type = multi_start_protocol::incumbent;
+                        reply.value = this->best.value;
+                        return multi_start_protocol::send(IN_CLIENT.socket_.get(), reply);
+                    }
+                    if (IN_HEADER.type == multi_start_protocol::result && IN_CLIENT.assigned == IN_HEADER.start_index) {
+                        if (this->record(IN_HEADER, std::move(IN_POINT))) {
+                            multi_start_protocol::message_header broadcast;
+                            broadcast.type = multi_start_protocol::incumbent;
+                            broadcast.value = this->best.value;
+                            // A worker that cannot take the broadcast is dropped when it is read next
+                            for (const auto &each : clients) {
+                                if (each && each.get() != &IN_CLIENT && each->assigned) {multi_start_protocol::send(each->socket_.get(), broadcast);}
+                            }
+                        }
+                        IN_CLIENT.assigned.reset();
+                        ++finished;
+                        return finished == this->starts.size() || assign(IN_CLIENT);
+                    }
+                    return IN_HEADER.type == multi_start_protocol::request_start && !IN_CLIENT.assigned && assign(IN_CLIENT);
+                };
+
+                for (std::size_t i = 2; i < poll_set.size(); ++i) {
+                    if (poll_set[i].revents == 0) {continue;}
+                    client &current = *clients[i - 2];
+                    multi_start_protocol::message_header header;
+                    std::vector<double> point;
+                    bool alive = (poll_set[i].revents & POLLIN) != 0 && aux::read_available(current.socket_.get(), current.input);
+                    while (alive && multi_start_protocol::decode(current.input, header, point, alive)) {
+                        alive = handle(current, header, std::move(point));
+                    }
+
+                    if (!alive) {
+                        if (current.assigned) {pending.push_front(*current.assigned);}
+                        clients[i - 2].reset();
+                    }
+                }
+                std::erase(clients, nullptr);
+
+                // Starts returned by disconnected workers go to parked workers first.
+                for (auto &each : clients) {
+                    if (each->waiting && !pending.empty() && !assign(*each)) {
+                        pending.push_front(*each->assigned);
+                        each.reset();
+                    }
+                }
+                std::erase(clients, nullptr);
+            }
+
+            multi_start_protocol::message_header done;
+            done.type = multi_start_protocol::done;
+            done.value = this->best.value;
+            for (const auto &each : clients) {multi_start_protocol::send(each->socket_.get(), done, this->best.point);}
+            ::unlink(IN_PATH.c_str());
+            VERBOSE_PRINT("Multi-start finished: " << this->best.completed << " completed, " << this->best.pruned << " pruned, " << this->best.failed << " failed, incumbent " << this->best.value);
+            return this->best;
+        }
+
+        /**
+         * @brief Makes serve() return early with the current incumbent.
+         */
+        void stop () noexcept {
+            if (!this->stop_requested.exchange(true)) {
+                const char byte = 0;
+                [[maybe_unused]] const auto written = ::write(this->wake_pipe[1], &byte, 1);
+            }
+        }
+
+    private:
+        struct client {
+            explicit client (aux::socket_fd IN_SOCKET) : socket_(std::move(IN_SOCKET)) {}
+            aux::socket_fd socket_;
+            std::optional<std::uint64_t> assigned;  ///< Start currently held by the worker.
+            bool waiting = false;                   ///< Worker is parked until a start is returned or the search ends.
+            std::vector<char> input;                ///< Bytes received but not decoded yet.
+        };
+
+        std::vector<std::vector<double>> starts;
+        multi_start_result best;
+        std::atomic<bool> stop_requested = false;
+        int wake_pipe[2] = {-1, -1};
+
+        /**
+         * @brief Counts a result and keeps it if it is the new incumbent.
+         *
+         * @return True if the incumbent value improved.
+         */
+        bool record (const multi_start_protocol::message_header &IN_HEADER, std::vector<double> &&IN_POINT) {
+            if ((IN_HEADER.flags & multi_start_protocol::failed) != 0) {
+                ++this->best.failed;
+                return false;
+            }
+            if ((IN_HEADER.flags & multi_start_protocol::pruned) != 0) {
+                ++this->best.pruned;
+                return false;
+            }
+            ++this->best.completed;
+            const bool improved = IN_HEADER.value < this->best.value;
+            // Ties go to the lower start index, independent of the order in which results arrive
+            if (improved || (IN_HEADER.value == this->best.value && IN_HEADER.start_index < this->best.start_index)) {
+                this->best.value = IN_HEADER.value;
+                this->best.point = std::move(IN_POINT);
+                this->best.start_index = IN_HEADER.start_index;
+            }
+            return improved;
+        }
+    };
+
+    /**
+     * @brief Worker of a distributed multi-start search.
+     *
+     * The multi_start_worker class drives one configured optimiser: it receives start points from the coordinator,
+     * optimises from each of them and reports the results. While optimising, it picks up the incumbent broadcasts
+     * of the coordinator every `poll_interval` iterations (without blocking) and prunes the start once its
+     * trajectory is clearly dominated. An iteration callback already set on the optimiser keeps being called.
+     *
+     * @tparam returnType The return type of the objective function.
+     * @tparam argType The types of the optimisation variables.
+     *
+     * @details
+     * A trajectory is clearly dominated when its current value exceeds the incumbent by more than the prune margin
+     * and, even if it kept improving at its average rate over the last `prune_window` iterations for another
+     * `prune_horizon` iterations, it would still not reach the incumbent. Averaging over a window keeps a single
+     * rejected step, which makes no progress, from pruning a start that is still descending quickly; no start is
+     * pruned before it has run for a whole window.
+     *
+     * @code{.cpp}
+     * // example
+     * gd::gradient_decent<double, double, double> solver(bivarient_function, 0.0, 0.0);
+     * solver.add_lower_bounds(-2.0, -2.0);
+     * solver.add_upper_bounds(2.0, 2.0);
+     * gd::multi_start_worker<double, double, double> worker(solver);
+     * worker.run("/tmp/multi_start.sock");
+     * @endcode
+     */
+    template <class returnType, class... argType>
+    class multi_start_worker {
+    public:
+        /**
+         * @brief Constructs the worker around a configured optimiser.
+         *
+         * @param IN_SOLVER The optimiser; it is re-targeted to every start with change_initial_guess().
+         */
+        explicit multi_start_worker (gd::gradient_decent<returnType, argType...> &IN_SOLVER) : solver(IN_SOLVER) {}
+
+        /**
+         * @brief Sets the margin above the incumbent within which a start is never pruned (default: 1e-6).
+         */
+        void set_prune_margin (returnType IN_MARGIN) noexcept {
+            this->prune_margin = IN_MARGIN;
+        }
+
+        /**
+         * @brief Sets the number of iterations a dominated trajectory is extrapolated over (default: 10).
+         */
+        void set_prune_horizon (std::size_t IN_HORIZON) noexcept {
+            this->prune_horizon = IN_HORIZON;
+        }
+
+        /**
+         * @brief Sets the number of iterations the improvement rate of a trajectory is averaged over (default: 5).
+         */
+        void set_prune_window (std::size_t IN_WINDOW) noexcept {
+            this->prune_window = std::max<std::size_t>(IN_WINDOW, 1);
+        }
+
+        /**
+         * @brief Sets how many iterations pass between checks for incumbent broadcasts (default: 1).
+         */
+        void set_poll_interval (std::size_t IN_INTERVAL) noexcept {
+            this->poll_interval = std::max<std::size_t>(IN_INTERVAL, 1);
+        }
+
+        /**
+         * @brief Connects to the coordinator and processes starts until it reports that the search is done.
+         *
+         * @param IN_PATH The Unix domain socket path of the coordinator.
+         * @return The number of starts processed by this worker.
+         */
+        std::size_t run (const std::string &IN_PATH) {
+            aux::socket_fd socket_ = aux::connect_unix(IN_PATH);
+            const int fd = socket_.get();
+            std::size_t processed = 0;
+            std::vector<char> input;
+            double incumbent = std::numeric_limits<double>::infinity();
+            bool done = false;
+
+            // Takes the complete messages received so far; returns false if the connection is lost
+            auto take_broadcasts = [&] () -> bool {
+                multi_start_protocol::message_header message;
+                std::vector<double> unused;
+                bool valid = aux::read_available(fd, input);
+                while (valid && multi_start_protocol::decode(input, message, unused, valid)) {
+                    if (message.type == multi_start_protocol::incumbent) {incumbent = std::min(incumbent, message.value);}
+                    else {done = true;}
+                }
+                return valid && !done;
+            };
+
+            multi_start_protocol::message_header header;
+            header.type = multi_start_protocol::request_start;
+            std::vector<double> point;
+            bool alive = multi_start_protocol::send(fd, header);
+            // Waits for the next start, taking the incumbent broadcasts that arrive in between
+            auto next_start = [&] () -> bool {
+                while (multi_start_protocol::receive(fd, input, header, point)) {
+                    if (header.type == multi_start_protocol::incumbent) {continue;}
+                    return header.type == multi_start_protocol::start && point.size() == sizeof...(argType);
+                }
+                return false;
+            };
+
+            const std::function<bool(std::size_t, returnType)> user_callback = this->solver.get_iteration_callback();
+            gd::convergence_history<returnType> history;
+            while (alive && !done && next_start()) {
+                incumbent = header.value;
+                history.reset(this->prune_window);
+                bool pruned = false;
+                this->solver.set_iteration_callback([&] (std::size_t IN_ITERATION, returnType IN_VALUE) -> bool {
+                    if (user_callback && !user_callback(IN_ITERATION, IN_VALUE)) {return false;}
+                    if (IN_ITERATION % this->poll_interval == 0 && !take_broadcasts()) {return false;}
+                    history.push(IN_VALUE);
+                    if (!history.has(this->prune_window)) {return true;}
+                    const returnType gap = IN_VALUE - static_cast<returnType>(incumbent);
+                    const returnType rate = (history.ago(this->prune_window) - IN_VALUE) / static_cast<returnType>(this->prune_window);
+                    pruned = gap > this->prune_margin && rate * static_cast<returnType>(this->prune_horizon) < gap;
+                    return !pruned;
+                });
+
+                multi_start_protocol::message_header result;
+                result.type = multi_start_protocol::result;
+                result.start_index = header.start_index;
+                std::vector<double> optimum;
+                try {
+                    this->solver.change_initial_guess(to_tuple(point, std::index_sequence_for<argType...>{}));
+                    auto [value, optimal_point] = this->solver.perform_gradient_decent();
+                    result.value = static_cast<double>(value);
+                    optimum = std::apply([] (auto... coordinate) {return std::vector<double>{static_cast<double>(coordinate)...};}, optimal_point);
+                    if (pruned) {result.flags |= multi_start_protocol::pruned;}
+                } catch (std::exception &e) {
+                    std::cerr << "Start " << header.start_index << " failed: " << e.what() << std::endl;
+                    result.flags |= multi_start_protocol::failed;
+                }
+                this->solver.set_iteration_callback(user_callback);
+                ++processed;
+                alive = multi_start_protocol::send(fd, result, optimum);
+            }
+            return processed;
+        }
+
+    private:
+        gd::gradient_decent<returnType, argType...> &solver;   ///< The configured optimiser.
+        returnType prune_margin = 0.000001;
+        std::size_t prune_horizon = 10;
+        std::size_t prune_window = 5;
+        std::size_t poll_interval = 1;
+
+        template <std::size_t... i>
+        static std::tuple<argType...> to_tuple (const std::vector<double> &IN_VALUES, std::index_sequence<i...>) {
+            return std::make_tuple(static_cast<argType>(IN_VALUES[i])...);
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_MULTI_START_COORDINATOR_H
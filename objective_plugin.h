@@ -0,0 +1,215 @@
+/**
+ * @file objective_plugin.h
+ * @brief Header file containing the loader and registry for objective plug-ins (see objective_plugin_abi.h).
+ *
+ * Plug-ins are shared libraries implementing the stable C ABI of objective_plugin_abi.h. They are loaded at
+ * runtime with dlopen and solved with the runtime-dimension optimiser (see dynamic_gradient_decent.h), so a
+ * long-running service can take new objectives live without being rebuilt or restarted.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_OBJECTIVE_PLUGIN_H
+#define CONCEPTUAL_OBJECTIVE_PLUGIN_H
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <dlfcn.h>
+
+#include "dynamic_gradient_decent.h"
+#include "objective_plugin_abi.h"
+
+namespace gd {
+    /**
+     * @brief A loaded objective plug-in.
+     *
+     * The objective_plugin class owns the dlopen handle and the plug-in's function table. The plug-in context is
+     * destroyed and the library unloaded when the object is destroyed; share it through std::shared_ptr so a
+     * reload never unloads a library that an in-flight solve is still using.
+     *
+     * @note A runtime_error is thrown if the library cannot be loaded, does not export the create function,
+     * fails to create the objective or reports an unsupported ABI version.
+     */
+    class objective_plugin {
+    public:
+        /**
+         * @brief Loads a plug-in.
+         *
+         * @param IN_PATH The path of the shared library.
+         * @param IN_CONFIG Plug-in specific configuration passed to the create function (default: empty).
+         */
+        explicit objective_plugin (const std::string &IN_PATH, const std::string &IN_CONFIG = {}) : path(IN_PATH) {
+            this->handle = ::dlopen(IN_PATH.c_str(), RTLD_NOW | RTLD_LOCAL);
+            if (this->handle == nullptr) {throw std::runtime_error("Cannot load objective plug-in " + IN_PATH + ": " + ::dlerror());}
+
+            auto create = reinterpret_cast<gd_objective_create_fn>(::dlsym(this->handle, GD_OBJECTIVE_CREATE_SYMBOL));
+            if (create == nullptr || create(IN_CONFIG.c_str(), &this->table) != 0 || this->table.abi_version != GD_OBJECTIVE_ABI_VERSION || this->table.evaluate == nullptr || this->table.dimension == 0) {
+                ::dlclose(this->handle);
+                throw std::runtime_error("Invalid objective plug-in " + IN_PATH);
+            }
+        }
+
+        objective_plugin (const objective_plugin&) = delete;
+        objective_plugin& operator= (const objective_plugin&) = delete;
+
+        /**
+         * @brief Destroys the plug-in context and unloads the library.
+         */
+        ~objective_plugin () {
+            if (this->table.destroy != nullptr) {this->table.destroy(this->table.context);}
+            ::dlclose(this->handle);
+        }
+
+        /**
+         * @brief Returns the number of optimisation variables.
+         */
+        [[nodiscard]] std::size_t dimension () const noexcept {
+            return this->table.dimension;
+        }
+
+        /**
+         * @brief Returns the path the plug-in was loaded from.
+         */
+        [[nodiscard]] const std::string& source () const noexcept {
+            return this->path;
+        }
+
+        /**
+         * @brief Evaluates the objective at a point.
+         */
+        [[nodiscard]] double evaluate (std::span<const double> IN_PARAMETERS, std::span<const double> IN_POINT) const {
+            return this->table.evaluate(this->table.context, IN_PARAMETERS.data(), IN_PARAMETERS.size(), IN_POINT.data());
+        }
+
+        /**
+         * @brief Returns true if the plug-in provides a batched evaluation.
+         */
+        [[nodiscard]] bool has_batch () const noexcept {
+            return this->table.evaluate_batch != nullptr;
+        }
+
+        /**
+         * @brief Evaluates the objective at several points stored back to back.
+         *
+         * Falls back to one evaluate() per point if the plug-in has no batched evaluation or the batch call fails.
+         */
+        void evaluate_batch (std::span<const double> IN_PARAMETERS, std::span<const double> IN_POINTS, std::span<double> OUT_VALUES) const {
+            if (this->table.evaluate_batch != nullptr &&
+                this->table.evaluate_batch(this->table.context, IN_PARAMETERS.data(), IN_PARAMETERS.size(), IN_POINTS.data(), OUT_VALUES.size(), OUT_VALUES.data()) == 0) {
+                return;
+            }
+            for (std::size_t i = 0; i < OUT_VALUES.size(); ++i) {
+                OUT_VALUES[i] = this->evaluate(IN_PARAMETERS, IN_POINTS.subspan(i * this->dimension(), this->dimension()));
+            }
+        }
+
+        /**
+         * @brief Returns true if the plug-in provides an analytic gradient.
+         */
+        [[nodiscard]] bool has_gradient () const noexcept {
+            return this->table.gradient != nullptr;
+        }
+
+        /**
+         * @brief Computes the analytic gradient at a point.
+         *
+         * @return False if the plug-in has no gradient or the gradient call fails.
+         */
+        bool gradient (std::span<const double> IN_PARAMETERS, std::span<const double> IN_POINT, std::span<double> OUT_GRADIENT) const {
+            return this->table.gradient != nullptr && this->table.gradient(this->table.context, IN_PARAMETERS.data(), IN_PARAMETERS.size(), IN_POINT.data(), OUT_GRADIENT.data()) == 0;
+        }
+
+        /**
+         * @brief Creates a runtime-dimension optimiser for this plug-in.
+         *
+         * The optimiser evaluates the plug-in with the parameters referenced by IN_PARAMETERS, uses the batched
+         * evaluation for finite differences and the analytic gradient when the plug-in provides them.
+         *
+         * @param IN_SELF Shared pointer to this plug-in, kept alive by the optimiser.
+         * @param IN_PARAMETERS Parameters of the objective; must outlive the optimiser (or be re-pointed per solve).
+         * @param IN_GUESS The initial guess.
+         * @return The configured optimiser.
+         */
+        static std::unique_ptr<gd::dynamic_gradient_decent<double>> make_solver (std::shared_ptr<const objective_plugin> IN_SELF, const std::span<const double> *IN_PARAMETERS, std::vector<double> IN_GUESS) {
+            const objective_plugin *plugin = IN_SELF.get();
+            auto solver = std::make_unique<gd::dynamic_gradient_decent<double>>(
+                    [IN_SELF, IN_PARAMETERS] (std::span<const double> IN_POINT) {return IN_SELF->evaluate(*IN_PARAMETERS, IN_POINT);},
+                    std::move(IN_GUESS));
+            if (plugin->has_batch()) {
+                solver->set_batch_objective([plugin, IN_PARAMETERS] (std::span<const double> IN_POINTS, std::span<double> OUT_VALUES) {
+                    plugin->evaluate_batch(*IN_PARAMETERS, IN_POINTS, OUT_VALUES);
+                });
+            }
+            if (plugin->has_gradient()) {
+                solver->set_gradient([plugin, IN_PARAMETERS] (std::span<const double> IN_POINT, std::span<double> OUT_GRADIENT) {
+                    return plugin->gradient(*IN_PARAMETERS, IN_POINT, OUT_GRADIENT);
+                });
+            }
+            return solver;
+        }
+
+    private:
+        std::string path;               ///< Path of the shared library.
+        void *handle = nullptr;         ///< dlopen handle.
+        gd_objective_v1 table{};        ///< The plug-in's function table.
+    };
+
+    /**
+     * @brief Thread-safe registry of loaded plug-ins.
+     *
+     * Plug-ins can be loaded, replaced and unloaded while other threads solve with them. Lookups return a
+     * std::shared_ptr, so a replaced plug-in stays loaded until its last solve finishes. Callers that cache
+     * per-plug-in state detect a replacement by comparing the plug-in returned by find() with the one their state
+     * holds; while the state holds it, the old plug-in cannot be freed and its address cannot be reused.
+     */
+    class plugin_registry {
+    public:
+        /**
+         * @brief Loads a plug-in under an id, replacing any plug-in registered under the same id.
+         *
+         * @param IN_ID The objective id.
+         * @param IN_PATH The path of the shared library.
+         * @param IN_CONFIG Plug-in specific configuration (default: empty).
+         * @return The loaded plug-in.
+         */
+        std::shared_ptr<const objective_plugin> load (std::uint32_t IN_ID, const std::string &IN_PATH, const std::string &IN_CONFIG = {}) {
+            auto plugin = std::make_shared<const objective_plugin>(IN_PATH, IN_CONFIG);
+            std::unique_lock lock(this->mutex);
+            this->plugins[IN_ID] = plugin;
+            return plugin;
+        }
+
+        /**
+         * @brief Unloads the plug-in registered under an id (in-flight solves keep it alive until they finish).
+         */
+        void unload (std::uint32_t IN_ID) {
+            std::unique_lock lock(this->mutex);
+            this->plugins.erase(IN_ID);
+        }
+
+        /**
+         * @brief Returns the plug-in registered under an id, or nullptr.
+         */
+        [[nodiscard]] std::shared_ptr<const objective_plugin> find (std::uint32_t IN_ID) const {
+            std::shared_lock lock(this->mutex);
+            const auto found = this->plugins.find(IN_ID);
+            return found == this->plugins.end() ? nullptr : found->second;
+        }
+
+    private:
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::uint32_t, std::shared_ptr<const objective_plugin>> plugins;
+    };
+}
+
+
+#endif //CONCEPTUAL_OBJECTIVE_PLUGIN_H
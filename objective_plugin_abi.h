@@ -0,0 +1,98 @@
+/**
+ * @file objective_plugin_abi.h
+ * @brief Stable C ABI for objective functions loaded from shared libraries.
+ *
+ * A plug-in is a shared library exporting one function, `gd_objective_create`, which fills in a
+ * gd_objective_v1 table. The table describes the dimension of the problem and provides the evaluation
+ * function, and optionally a batched evaluation and an analytic gradient. The header is plain C so plug-ins
+ * can be written in C, C++ or any language with a C FFI, and can be built without the optimiser headers.
+ *
+ * @code{.c}
+ * // example plug-in, built with: cc -shared -fPIC -o libbivarient.so bivarient.c
+ * #include <math.h>
+ * #include "objective_plugin_abi.h"
+ *
+ * static double evaluate (void *context, const double *parameters, size_t parameter_count, const double *x) {
+ *     const double A = parameter_count > 0 ? parameters[0] : 10.0;
+ *     return (A * x[0] * x[1]) / exp(x[0] * x[0] + x[1] * x[1]) + 5.0 / exp(1.0);
+ * }
+ *
+ * GD_OBJECTIVE_EXPORT int gd_objective_create (const char *config, gd_objective_v1 *out) {
+ *     out->abi_version = GD_OBJECTIVE_ABI_VERSION;
+ *     out->dimension = 2;
+ *     out->evaluate = evaluate;
+ *     return 0;
+ * }
+ * @endcode
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_OBJECTIVE_PLUGIN_ABI_H
+#define CONCEPTUAL_OBJECTIVE_PLUGIN_ABI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Version of the objective table; bumped on any incompatible change.
+ */
+#define GD_OBJECTIVE_ABI_VERSION 1u
+
+/**
+ * @brief Name of the function every plug-in exports.
+ */
+#define GD_OBJECTIVE_CREATE_SYMBOL "gd_objective_create"
+
+/**
+ * @brief Marks the create function as exported with C linkage.
+ */
+#ifdef __cplusplus
+#define GD_OBJECTIVE_EXPORT extern "C" __attribute__((visibility("default")))
+#else
+#define GD_OBJECTIVE_EXPORT __attribute__((visibility("default")))
+#endif
+
+/**
+ * @brief Function table describing one objective (version 1).
+ *
+ * All pointers except `evaluate` may be NULL. The table is zero-initialised by the loader before
+ * `gd_objective_create` is called.
+ */
+typedef struct gd_objective_v1 {
+    /** Must be set to GD_OBJECTIVE_ABI_VERSION. */
+    uint32_t abi_version;
+    /** Number of optimisation variables. */
+    uint32_t dimension;
+    /** Opaque plug-in state passed back to every call. */
+    void *context;
+    /** Evaluates the objective at `x` (dimension doubles) for the given parameters. */
+    double (*evaluate) (void *context, const double *parameters, size_t parameter_count, const double *x);
+    /** Optional: evaluates `count` points stored back to back in `x`, writing `count` values to `out`. Returns 0 on success. */
+    int (*evaluate_batch) (void *context, const double *parameters, size_t parameter_count, const double *x, size_t count, double *out);
+    /** Optional: writes the gradient at `x` (dimension doubles) to `out`. Returns 0 on success. */
+    int (*gradient) (void *context, const double *parameters, size_t parameter_count, const double *x, double *out);
+    /** Optional: releases `context`. Called once before the library is unloaded. */
+    void (*destroy) (void *context);
+} gd_objective_v1;
+
+/**
+ * @brief Signature of the exported create function.
+ *
+ * @param config Plug-in specific configuration string (may be NULL).
+ * @param out The table to fill in.
+ * @return 0 on success, non-zero on failure.
+ */
+typedef int (*gd_objective_create_fn) (const char *config, gd_objective_v1 *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif //CONCEPTUAL_OBJECTIVE_PLUGIN_ABI_H
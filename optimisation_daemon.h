@@ -0,0 +1,701 @@
+/**
+ * @file optimisation_daemon.h
+ * @brief Header file containing a local optimisation daemon serving solve requests over a Unix domain socket.
+ *
+ * Starting a process per solve often costs more than the solve itself. The optimisation daemon registers a
+ * set of compiled objectives once, listens on a Unix domain socket for compact binary solve requests and
+ * serves them as tasks on a work-stealing scheduler (see work_stealing_scheduler.h) with a pool of reusable,
+ * configured optimisers per objective. Queue depth and latency metrics can be queried over the same socket.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_OPTIMISATION_DAEMON_H
+#define CONCEPTUAL_OPTIMISATION_DAEMON_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <poll.h>
+
+#include "gradient_decent.h"
+#include "objective_plugin.h"
+#include "unix_socket.h"
+#include "work_stealing_scheduler.h"
+
+namespace gd {
+    /**
+     * @brief Wire format of the optimisation daemon.
+     *
+     * A request is a request_header followed by `parameter_count` parameters, `dimension` initial guess
+     * coordinates and, if the bounds flag is set, `dimension` lower and `dimension` upper bounds (all doubles).
+     * A response is a response_header followed by `dimension` coordinates of the optimal point. A request with
+     * objective id `metrics_objective` is answered with a response_header with magic `metrics_magic` followed by a
+     * metrics struct instead; both kinds of response echo the request tag. All values are in host byte order, as
+     * both ends live on the same machine.
+     */
+    namespace daemon_protocol {
+        constexpr std::uint32_t request_magic = 0x47445251;     ///< "GDRQ"
+        constexpr std::uint32_t response_magic = 0x47445253;    ///< "GDRS"
+        constexpr std::uint32_t metrics_magic = 0x4744524D;     ///< "GDRM"
+        constexpr std::uint32_t metrics_objective = 0xFFFFFFFF; ///< Objective id reserved for metrics queries.
+        constexpr std::uint32_t max_count = 1U << 20;           ///< Largest accepted parameter count or dimension.
+
+        /**
+         * @brief Request flags.
+         */
+        enum flags : std::uint32_t {
+            classic_gd = 1U << 0,           ///< Use classic gradient descent with back-tracking.
+            derivative_scaling = 1U << 1,   ///< Use derivative based learning rate scaling.
+            bounds = 1U << 2,               ///< Lower and upper bounds follow the initial guess.
+            parallel_derivatives = 1U << 3  ///< Evaluate the finite difference stencil in parallel on the daemon's scheduler.
+        };
+
+        /**
+         * @brief Response status codes.
+         */
+        enum status : std::int32_t {
+            ok = 0,                 ///< The solve converged.
+            unknown_objective = 1,  ///< No objective is registered under the requested id.
+            bad_request = 2,        ///< The request does not match the registered objective.
+            failed = 3              ///< The solve threw (e.g. failed to converge).
+        };
+
+        struct request_header {
+            std::uint32_t magic = request_magic;
+            std::uint32_t objective_id = 0;
+            std::uint64_t tag = 0;              ///< Echoed back in the response to match pipelined requests.
+            std::uint32_t parameter_count = 0;
+            std::uint32_t dimension = 0;
+            std::uint32_t flags = 0;
+            std::uint32_t max_eval = 1000;
+            double tolerance = 0.00001;
+        };
+
+        struct response_header {
+            std::uint32_t magic = response_magic;
+            std::int32_t status = ok;
+            std::uint64_t tag = 0;
+            std::uint32_t dimension = 0;
+            std::uint32_t reserved = 0;
+            double value = 0.0;
+            std::uint64_t func_calls = 0;
+        };
+
+        struct metrics {
+            std::uint64_t queue_depth = 0;      ///< Requests waiting for a worker.
+            std::uint64_t in_flight = 0;        ///< Requests being solved.
+            std::uint64_t served = 0;           ///< Requests answered (including failures).
+            std::uint64_t failed = 0;           ///< Requests answered with a non-ok status.
+            double mean_latency_us = 0.0;       ///< Mean time from receipt to response, in microseconds.
+            double max_latency_us = 0.0;        ///< Largest time from receipt to response, in microseconds.
+            double mean_solve_us = 0.0;         ///< Mean time spent in the solver, in microseconds.
+        };
+    }
+
+    /**
+     * @brief Decoded solve request.
+     */
+    struct solve_request {
+        daemon_protocol::request_header header;
+        std::vector<double> parameters;
+        std::vector<double> guess;
+        std::vector<double> lower_bounds;
+        std::vector<double> upper_bounds;
+    };
+
+    /**
+     * @brief Decoded solve response.
+     */
+    struct solve_response {
+        daemon_protocol::response_header header;
+        std::vector<double> point;
+    };
+
+    /**
+     * @brief Long-running optimisation service on a Unix domain socket.
+     *
+     * The optimisation_daemon class owns a registry of objectives and runs its solves on a work-stealing scheduler.
+     * serve() runs the I/O loop on the calling thread: it accepts connections, decodes requests and submits them
+     * to the scheduler, whose workers solve and write the responses. Requests on one connection may be pipelined; the
+     * responses carry the request tag and are written in completion order. Connections are read without blocking
+     * into a buffer per connection, and a request is decoded once all of its bytes have arrived, so a slow or
+     * stalled client never holds up the others.
+     *
+     * @details
+     * Registered objectives take the request parameters as their first argument:
+     * @code{.cpp}
+     * // example
+     * gd::optimisation_daemon daemon(8);
+     * daemon.register_objective<double, double, double>(1, [] (std::span<const double> p, double x, double y) {
+     *     return p[0] * x * x + p[1] * y * y;
+     * });
+     * daemon.serve("/tmp/gradient_decent.sock");   // blocks until stop() is called
+     * @endcode
+     *
+     * Optimisers are kept in a pool per objective: a request checks one out (creating it on the first requests for
+     * that objective), re-targets it (see gradient_decent::change_initial_guess()) and returns it afterwards, so
+     * steady-state requests do not allocate a new optimiser or wrap the objective again. Requests with the
+     * parallel derivatives flag evaluate their stencil on the same scheduler, so concurrent requests and their
+     * nested parallel evaluations share one set of worker threads. The pool is kept per NUMA node of the scheduler
+     * (see aux::thread_placement), so a pinned worker reuses workspaces first touched on its own node.
+     *
+     * Objectives can also be loaded from plug-ins at any time (see load_plugin()); they are solved with the
+     * runtime-dimension optimiser gd::dynamic_gradient_decent.
+     */
+    class optimisation_daemon {
+    public:
+        /**
+         * @brief Constructs the daemon on a scheduler.
+         *
+         * @param IN_SCHEDULER The scheduler running the solves (default: aux::work_stealing_scheduler::shared()).
+         */
+        explicit optimisation_daemon (std::shared_ptr<aux::work_stealing_scheduler> IN_SCHEDULER = aux::work_stealing_scheduler::shared()) :
+                scheduler(std::move(IN_SCHEDULER)), jobs(*this->scheduler) {
+            if (::pipe(this->wake_pipe) != 0) {throw std::runtime_error("Cannot create daemon wake-up pipe");}
+        }
+
+        /**
+         * @brief Constructs the daemon on a scheduler of its own.
+         *
+         * @param IN_THREADS The number of worker threads.
+         * @param IN_PLACEMENT The placement of the worker threads (default: aux::thread_placement::none).
+         */
+        explicit optimisation_daemon (std::size_t IN_THREADS, aux::thread_placement IN_PLACEMENT = aux::thread_placement::none) :
+                optimisation_daemon(std::make_shared<aux::work_stealing_scheduler>(IN_THREADS, IN_PLACEMENT)) {}
+
+        optimisation_daemon (const optimisation_daemon&) = delete;
+        optimisation_daemon& operator= (const optimisation_daemon&) = delete;
+
+        /**
+         * @brief Stops serving and waits for the requests being solved.
+         */
+        ~optimisation_daemon () {
+            this->stop();
+            try {this->jobs.wait();}
+            catch (std::exception &e) {std::cerr << "Daemon job failed: " << e.what() << std::endl;}
+            ::close(this->wake_pipe[0]);
+            ::close(this->wake_pipe[1]);
+        }
+
+        /**
+         * @brief Registers a compiled objective under an id.
+         *
+         * @tparam returnType The return type of the objective function.
+         * @tparam argType The types of the optimisation variables.
+         * @tparam funcType The type of the objective function, callable as
+         *                  `returnType(std::span<const double>, argType...)`.
+         * @param IN_ID The objective id used in requests.
+         * @param IN_FUNC The objective function.
+         *
+         * @note Objectives must be registered before serve() is called.
+         */
+        template <class returnType, class... argType, class funcType>
+        requires (std::is_invocable_r_v<returnType, meta_types::remove_all_qual<funcType>, std::span<const double>, argType...>)
+        void register_objective (std::uint32_t IN_ID, funcType &&IN_FUNC) {
+            using workspace = objective_workspace<returnType, argType...>;
+            auto function = std::make_shared<typename workspace::function_type>(std::forward<funcType>(IN_FUNC));
+            this->objectives[IN_ID] = registered_objective{
+                sizeof...(argType),
+                [function] (const solve_request &IN_REQUEST) -> std::unique_ptr<workspace_base> {
+                    return std::make_unique<workspace>(function, IN_REQUEST);
+                }
+            };
+            VERBOSE_PRINT("Registered objective " << IN_ID << " with " << sizeof...(argType) << " variables...");
+        }
+
+        /**
+         * @brief Loads (or replaces) a plug-in objective under an id (see objective_plugin_abi.h).
+         *
+         * Unlike register_objective(), this may be called while the daemon is serving: new requests for the id
+         * use the new plug-in, and pooled workspaces of the previous plug-in are rebuilt on their next checkout. Requests already
+         * being solved keep the previous plug-in loaded until they finish. Compiled objectives take precedence
+         * over plug-ins with the same id.
+         *
+         * @param IN_ID The objective id used in requests.
+         * @param IN_PATH The path of the plug-in shared library.
+         * @param IN_CONFIG Plug-in specific configuration (default: empty).
+         */
+        void load_plugin (std::uint32_t IN_ID, const std::string &IN_PATH, const std::string &IN_CONFIG = {}) {
+            const auto plugin = this->plugins.load(IN_ID, IN_PATH, IN_CONFIG);
+            VERBOSE_PRINT("Loaded plug-in objective " << IN_ID << " with " << plugin->dimension() << " variables from " << IN_PATH);
+        }
+
+        /**
+         * @brief Unloads the plug-in objective registered under an id.
+         */
+        void unload_plugin (std::uint32_t IN_ID) {
+            this->plugins.unload(IN_ID);
+        }
+
+        /**
+         * @brief Serves requests on the given socket path until stop() is called.
+         *
+         * @param IN_PATH The Unix domain socket path. A stale socket file at this path is replaced.
+         */
+        void serve (const std::string &IN_PATH) {
+            aux::socket_fd listener = aux::listen_unix(IN_PATH);
+            std::vector<std::shared_ptr<connection>> connections;
+            VERBOSE_PRINT("Optimisation daemon listening on " << IN_PATH);
+
+            while (!this->stop_requested) {
+                std::vector<pollfd> poll_set{{this->wake_pipe[0], POLLIN, 0}, {listener.get(), POLLIN, 0}};
+                for (const auto &each : connections) {poll_set.push_back({each->socket_.get(), POLLIN, 0});}
+                if (::poll(poll_set.data(), poll_set.size(), -1) < 0) {
+                    if (errno == EINTR) {continue;}
+                    break;
+                }
+                if (poll_set[0].revents != 0) {break;}
+                if ((poll_set[1].revents & POLLIN) != 0) {
+                    aux::socket_fd client(::accept(listener.get(), nullptr, nullptr));
+                    if (client.valid()) {connections.push_back(std::make_shared<connection>(std::move(client)));}
+                }
+                for (std::size_t i = 2; i < poll_set.size(); ++i) {
+                    if (poll_set[i].revents == 0) {continue;}
+                    auto &client = connections[i - 2];
+                    if ((poll_set[i].revents & POLLIN) == 0 || !this->receive(client)) {client.reset();}
+                }
+                std::erase(connections, nullptr);
+            }
+            ::unlink(IN_PATH.c_str());
+        }
+
+        /**
+         * @brief Makes serve() return. Requests already queued are still answered.
+         *
+         * @note Only performs an atomic store and a pipe write, so it may be called from a signal handler.
+         */
+        void stop () noexcept {
+            if (!this->stop_requested.exchange(true)) {
+                const char byte = 0;
+                [[maybe_unused]] const auto written = ::write(this->wake_pipe[1], &byte, 1);
+            }
+        }
+
+        /**
+         * @brief Returns a snapshot of the queue depth and latency metrics.
+         */
+        [[nodiscard]] daemon_protocol::metrics get_metrics () const {
+            daemon_protocol::metrics snapshot;
+            std::lock_guard lock(this->metrics_mutex);
+            snapshot.queue_depth = this->queued;
+            snapshot.in_flight = this->in_flight;
+            snapshot.served = this->served;
+            snapshot.failed = this->failed;
+            snapshot.max_latency_us = this->max_latency_us;
+            if (this->served > 0) {
+                snapshot.mean_latency_us = this->total_latency_us / static_cast<double>(this->served);
+                snapshot.mean_solve_us = this->total_solve_us / static_cast<double>(this->served);
+            }
+            return snapshot;
+        }
+
+    protected:
+        using clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Pooled, per-objective reusable solver state.
+         */
+        struct workspace_base {
+            virtual ~workspace_base () = default;
+            virtual void solve (const solve_request &IN_REQUEST, solve_response &OUT_RESPONSE, const std::shared_ptr<aux::work_stealing_scheduler> &IN_SCHEDULER) = 0;
+            /**
+             * @brief Returns the plug-in the workspace was built for (nullptr for compiled objectives).
+             */
+            [[nodiscard]] virtual const objective_plugin* plugin () const noexcept {return nullptr;}
+        };
+
+        /**
+         * @brief Reusable runtime-dimension optimiser for one loaded plug-in.
+         */
+        struct plugin_workspace final : workspace_base {
+            plugin_workspace (std::shared_ptr<const objective_plugin> IN_PLUGIN, const solve_request &IN_REQUEST) :
+                    source(IN_PLUGIN.get()), parameters(IN_REQUEST.parameters),
+                    solver(objective_plugin::make_solver(std::move(IN_PLUGIN), &this->parameters, IN_REQUEST.guess)) {}
+
+            void solve (const solve_request &IN_REQUEST, solve_response &OUT_RESPONSE, const std::shared_ptr<aux::work_stealing_scheduler> &IN_SCHEDULER) override {
+                const auto &header = IN_REQUEST.header;
+                const std::size_t n = IN_REQUEST.guess.size();
+                this->parameters = IN_REQUEST.parameters;
+                if (this->classic_gd != ((header.flags & daemon_protocol::classic_gd) != 0)) {
+                    this->solver->toggle_classic_gradient_algo();
+                    this->classic_gd = !this->classic_gd;
+                }
+                if (this->derivative_scaling != ((header.flags & daemon_protocol::derivative_scaling) != 0)) {
+                    this->solver->toggle_derivative_scaling();
+                    this->derivative_scaling = !this->derivative_scaling;
+                }
+                if (this->parallel_derivatives != ((header.flags & daemon_protocol::parallel_derivatives) != 0)) {
+                    this->solver->toggle_parallel_derivatives();
+                    this->parallel_derivatives = !this->parallel_derivatives;
+                }
+                this->solver->set_scheduler(IN_SCHEDULER);
+                this->solver->set_tolerance(header.tolerance);
+                this->solver->set_max_eval(header.max_eval);
+                const bool has_bounds = (header.flags & daemon_protocol::bounds) != 0;
+                this->solver->add_lower_bounds(has_bounds ? IN_REQUEST.lower_bounds : std::vector<double>(n, std::numeric_limits<double>::lowest()));
+                this->solver->add_upper_bounds(has_bounds ? IN_REQUEST.upper_bounds : std::vector<double>(n, std::numeric_limits<double>::max()));
+                // the solver was created at the guess of the first request, and the objective was evaluated there
+                if (!std::exchange(this->fresh, false)) {this->solver->change_initial_guess(IN_REQUEST.guess);}
+
+                auto [value, point] = this->solver->perform_gradient_decent();
+                OUT_RESPONSE.header.value = value;
+                OUT_RESPONSE.header.func_calls = this->solver->get_func_call_count();
+                OUT_RESPONSE.point = std::move(point);
+            }
+
+            [[nodiscard]] const objective_plugin* plugin () const noexcept override {return this->source;}
+
+        private:
+            const objective_plugin *source;
+            std::span<const double> parameters;
+            std::unique_ptr<gd::dynamic_gradient_decent<double>> solver;
+            bool classic_gd = false;
+            bool derivative_scaling = false;
+            bool parallel_derivatives = false;
+            bool fresh = true;      ///< True until the first solve, which starts from the guess the solver was created at.
+        };
+
+        /**
+         * @brief Reusable optimiser for one registered objective.
+         *
+         * The wrapped objective reads the parameters of the current request through a span owned by the workspace,
+         * so the optimiser (and its std::function) is created once and only re-targeted per request.
+         */
+        template <class returnType, class... argType>
+        struct objective_workspace final : workspace_base {
+            using function_type = std::function<returnType(std::span<const double>, argType...)>;
+
+            objective_workspace (std::shared_ptr<function_type> IN_FUNCTION, const solve_request &IN_REQUEST) :
+                    function(std::move(IN_FUNCTION)), parameters(IN_REQUEST.parameters) {
+                auto objective = [this] (argType... args) -> returnType {return (*this->function)(this->parameters, args...);};
+                this->solver = std::apply([&objective] (auto... guess) {
+                    return std::make_unique<gd::gradient_decent<returnType, argType...>>(objective, guess...);
+                }, to_tuple(IN_REQUEST.guess, std::index_sequence_for<argType...>{}));
+            }
+
+            void solve (const solve_request &IN_REQUEST, solve_response &OUT_RESPONSE, const std::shared_ptr<aux::work_stealing_scheduler> &IN_SCHEDULER) override {
+                const auto &header = IN_REQUEST.header;
+                this->parameters = IN_REQUEST.parameters;
+                this->set_flag(this->classic_gd, (header.flags & daemon_protocol::classic_gd) != 0, &gd::gradient_decent<returnType, argType...>::toggle_classic_gradient_algo);
+                this->set_flag(this->derivative_scaling, (header.flags & daemon_protocol::derivative_scaling) != 0, &gd::gradient_decent<returnType, argType...>::toggle_derivative_scaling);
+                this->set_flag(this->parallel_derivatives, (header.flags & daemon_protocol::parallel_derivatives) != 0, &gd::gradient_decent<returnType, argType...>::toggle_parallel_derivatives);
+                this->solver->set_scheduler(IN_SCHEDULER);
+                this->solver->set_tolerance(static_cast<returnType>(header.tolerance));
+                this->solver->set_max_eval(header.max_eval);
+                if ((header.flags & daemon_protocol::bounds) != 0) {
+                    this->solver->add_lower_bounds(to_tuple(IN_REQUEST.lower_bounds, std::index_sequence_for<argType...>{}));
+                    this->solver->add_upper_bounds(to_tuple(IN_REQUEST.upper_bounds, std::index_sequence_for<argType...>{}));
+                } else {
+                    this->solver->add_lower_bounds(std::make_tuple(std::numeric_limits<argType>::lowest()...));
+                    this->solver->add_upper_bounds(std::make_tuple(std::numeric_limits<argType>::max()...));
+                }
+                // the solver was created at the guess of the first request, and the objective was evaluated there
+                if (!std::exchange(this->fresh, false)) {this->solver->change_initial_guess(to_tuple(IN_REQUEST.guess, std::index_sequence_for<argType...>{}));}
+
+                auto [value, point] = this->solver->perform_gradient_decent();
+                OUT_RESPONSE.header.value = static_cast<double>(value);
+                OUT_RESPONSE.header.func_calls = this->solver->get_func_call_count();
+                OUT_RESPONSE.point = std::apply([] (auto... coordinate) {return std::vector<double>{static_cast<double>(coordinate)...};}, point);
+            }
+
+        private:
+            std::shared_ptr<function_type> function;
+            std::span<const double> parameters;
+            std::unique_ptr<gd::gradient_decent<returnType, argType...>> solver;
+            bool classic_gd = false;
+            bool derivative_scaling = false;
+            bool parallel_derivatives = false;
+            bool fresh = true;      ///< True until the first solve, which starts from the guess the solver was created at.
+
+            void set_flag (bool &IN_CURRENT, bool IN_REQUESTED, void (gd::gradient_decent<returnType, argType...>::*IN_TOGGLE)()) {
+                if (IN_CURRENT != IN_REQUESTED) {
+                    ((*this->solver).*IN_TOGGLE)();
+                    IN_CURRENT = IN_REQUESTED;
+                }
+            }
+
+            template <std::size_t... i>
+            static std::tuple<argType...> to_tuple (const std::vector<double> &IN_VALUES, std::index_sequence<i...>) {
+                return std::make_tuple(static_cast<argType>(IN_VALUES[i])...);
+            }
+        };
+
+        struct registered_objective {
+            std::size_t dimension = 0;
+            std::function<std::unique_ptr<workspace_base>(const solve_request&)> make_workspace;
+        };
+
+        struct connection {
+            explicit connection (aux::socket_fd IN_SOCKET) : socket_(std::move(IN_SOCKET)) {}
+            aux::socket_fd socket_;
+            std::mutex write_mutex;     ///< Serialises responses written by different tasks.
+            std::vector<char> input;    ///< Bytes received but not yet decoded; only touched by the I/O loop.
+        };
+
+        struct job {
+            std::shared_ptr<connection> client;
+            solve_request request;
+            clock::time_point received;
+        };
+
+        std::unordered_map<std::uint32_t, registered_objective> objectives;
+        plugin_registry plugins;
+        std::mutex pool_mutex;
+        std::unordered_map<std::uint64_t, std::vector<std::unique_ptr<workspace_base>>> pool;  ///< Idle workspaces per objective and NUMA node.
+        std::atomic<bool> stop_requested = false;
+        int wake_pipe[2] = {-1, -1};
+
+        mutable std::mutex metrics_mutex;
+        std::uint64_t queued = 0;
+        std::uint64_t in_flight = 0;
+        std::uint64_t served = 0;
+        std::uint64_t failed = 0;
+        double total_latency_us = 0.0;
+        double max_latency_us = 0.0;
+        double total_solve_us = 0.0;
+
+        std::shared_ptr<aux::work_stealing_scheduler> scheduler;
+        aux::task_group jobs;       ///< Requests submitted to the scheduler and not yet answered.
+
+        /**
+         * @brief Reads what has arrived on a readable connection and submits every complete request (or answers
+         * metrics queries).
+         *
+         * @return False if the connection was closed or sent a malformed request.
+         */
+        bool receive (const std::shared_ptr<connection> &IN_CLIENT) {
+            std::vector<char> &input = IN_CLIENT->input;
+            if (!aux::read_available(IN_CLIENT->socket_.get(), input)) {return false;}
+            std::size_t consumed = 0;
+            bool valid = true;
+            while (valid) {
+                const std::size_t size = this->decode(IN_CLIENT, std::span<const char>(input).subspan(consumed), valid);
+                if (size == 0) {break;}
+                consumed += size;
+            }
+            input.erase(input.begin(), input.begin() + static_cast<std::ptrdiff_t>(consumed));
+            return valid;
+        }
+
+        /**
+         * @brief Decodes the first request of the received bytes and submits it (or answers a metrics query).
+         *
+         * @param IN_CLIENT The connection the bytes were received on.
+         * @param IN_BYTES The received bytes that are not decoded yet.
+         * @param OUT_VALID Set to false if the request is malformed.
+         * @return The size of the decoded request, 0 if it has not fully arrived yet (or is malformed).
+         */
+        std::size_t decode (const std::shared_ptr<connection> &IN_CLIENT, std::span<const char> IN_BYTES, bool &OUT_VALID) {
+            job next{IN_CLIENT, {}, clock::now()};
+            auto &header = next.request.header;
+            if (IN_BYTES.size() < sizeof(header)) {return 0;}
+            std::memcpy(&header, IN_BYTES.data(), sizeof(header));
+            if (header.magic != daemon_protocol::request_magic) {
+                OUT_VALID = false;
+                return 0;
+            }
+
+            if (header.objective_id == daemon_protocol::metrics_objective) {
+                daemon_protocol::response_header reply;
+                reply.magic = daemon_protocol::metrics_magic;
+                reply.tag = header.tag;
+                const daemon_protocol::metrics snapshot = this->get_metrics();
+                std::lock_guard lock(IN_CLIENT->write_mutex);
+                const int fd = IN_CLIENT->socket_.get();
+                OUT_VALID = aux::write_exact(fd, &reply, sizeof(reply)) && aux::write_exact(fd, &snapshot, sizeof(snapshot));
+                return OUT_VALID ? sizeof(header) : 0;
+            }
+
+            if (header.parameter_count > daemon_protocol::max_count || header.dimension > daemon_protocol::max_count) {
+                OUT_VALID = false;
+                return 0;
+            }
+            const bool has_bounds = (header.flags & daemon_protocol::bounds) != 0;
+            const std::size_t size = sizeof(header) + (header.parameter_count + (has_bounds ? 3 : 1) * std::size_t{header.dimension}) * sizeof(double);
+            if (IN_BYTES.size() < size) {return 0;}
+            const char *values = IN_BYTES.data() + sizeof(header);
+            auto read_doubles = [&values] (std::vector<double> &OUT_VALUES, std::size_t IN_COUNT) {
+                OUT_VALUES.resize(IN_COUNT);
+                std::memcpy(OUT_VALUES.data(), values, IN_COUNT * sizeof(double));
+                values += IN_COUNT * sizeof(double);
+            };
+            read_doubles(next.request.parameters, header.parameter_count);
+            read_doubles(next.request.guess, header.dimension);
+            if (has_bounds) {
+                read_doubles(next.request.lower_bounds, header.dimension);
+                read_doubles(next.request.upper_bounds, header.dimension);
+            }
+
+            {
+                std::lock_guard lock(this->metrics_mutex);
+                ++this->queued;
+            }
+            this->jobs.run([this, current = std::move(next)] () {this->run_job(current);});
+            return size;
+        }
+
+        /**
+         * @brief Scheduler task body: solves one job with a pooled workspace and writes the response.
+         */
+        void run_job (const job &IN_JOB) {
+            {
+                std::lock_guard lock(this->metrics_mutex);
+                --this->queued;
+                ++this->in_flight;
+            }
+
+            const clock::time_point start = clock::now();
+            solve_response response;
+            response.header.tag = IN_JOB.request.header.tag;
+            response.header.status = this->process(IN_JOB.request, response);
+            response.header.dimension = static_cast<std::uint32_t>(response.point.size());
+            const clock::time_point solved = clock::now();
+
+            {
+                std::lock_guard lock(IN_JOB.client->write_mutex);
+                const int fd = IN_JOB.client->socket_.get();
+                if (aux::write_exact(fd, &response.header, sizeof(response.header))) {
+                    aux::write_exact(fd, response.point.data(), response.point.size() * sizeof(double));
+                }
+            }
+            this->record(IN_JOB.received, start, solved, response.header.status);
+        }
+
+        /**
+         * @brief Solves one request with a workspace checked out of the pool, creating it if none is idle.
+         *
+         * @return The response status.
+         */
+        std::int32_t process (const solve_request &IN_REQUEST, solve_response &OUT_RESPONSE) {
+            const auto found = this->objectives.find(IN_REQUEST.header.objective_id);
+            std::shared_ptr<const objective_plugin> plugin;
+            if (found == this->objectives.end()) {
+                plugin = this->plugins.find(IN_REQUEST.header.objective_id);
+                if (!plugin) {return daemon_protocol::unknown_objective;}
+                if (plugin->dimension() != IN_REQUEST.header.dimension) {return daemon_protocol::bad_request;}
+            } else if (found->second.dimension != IN_REQUEST.header.dimension) {return daemon_protocol::bad_request;}
+            const std::uint64_t pool_key = (static_cast<std::uint64_t>(this->scheduler->current_node()) << 32) | IN_REQUEST.header.objective_id;
+            std::unique_ptr<workspace_base> workspace;
+            {
+                std::lock_guard lock(this->pool_mutex);
+                auto &idle = this->pool[pool_key];
+                if (!idle.empty()) {
+                    workspace = std::move(idle.back());
+                    idle.pop_back();
+                }
+            }
+            try {
+                if (plugin && (!workspace || workspace->plugin() != plugin.get())) {workspace = std::make_unique<plugin_workspace>(plugin, IN_REQUEST);}
+                if (!workspace) {workspace = found->second.make_workspace(IN_REQUEST);}
+                workspace->solve(IN_REQUEST, OUT_RESPONSE, this->scheduler);
+            } catch (std::exception &e) {
+                std::cerr << "Daemon solve failed for objective " << IN_REQUEST.header.objective_id << ": " << e.what() << std::endl;
+                OUT_RESPONSE.point.clear();
+                return daemon_protocol::failed;
+            }
+            std::lock_guard lock(this->pool_mutex);
+            this->pool[pool_key].push_back(std::move(workspace));
+            return daemon_protocol::ok;
+        }
+
+        void record (clock::time_point IN_RECEIVED, clock::time_point IN_START, clock::time_point IN_SOLVED, std::int32_t IN_STATUS) {
+            using microseconds = std::chrono::duration<double, std::micro>;
+            const double latency = microseconds(clock::now() - IN_RECEIVED).count();
+            std::lock_guard lock(this->metrics_mutex);
+            --this->in_flight;
+            ++this->served;
+            if (IN_STATUS != daemon_protocol::ok) {++this->failed;}
+            this->total_latency_us += latency;
+            this->total_solve_us += microseconds(IN_SOLVED - IN_START).count();
+            this->max_latency_us = std::max(this->max_latency_us, latency);
+        }
+    };
+
+    /**
+     * @brief Blocking client for the optimisation daemon.
+     *
+     * @code{.cpp}
+     * // example
+     * gd::daemon_client client("/tmp/gradient_decent.sock");
+     * gd::solve_request request;
+     * request.header.objective_id = 1;
+     * request.parameters = {1.0, 2.0};
+     * request.guess = {1.6, -1.2};
+     * auto response = client.solve(request);
+     * @endcode
+     */
+    class daemon_client {
+    public:
+        /**
+         * @brief Connects to the daemon.
+         *
+         * @param IN_PATH The Unix domain socket path of the daemon.
+         */
+        explicit daemon_client (const std::string &IN_PATH) : socket_(aux::connect_unix(IN_PATH)) {}
+
+        /**
+         * @brief Sends a solve request and waits for its response.
+         *
+         * The parameter count and dimension in the header are filled in from the request vectors.
+         */
+        solve_response solve (solve_request IN_REQUEST) {
+            auto &header = IN_REQUEST.header;
+            header.parameter_count = static_cast<std::uint32_t>(IN_REQUEST.parameters.size());
+            header.dimension = static_cast<std::uint32_t>(IN_REQUEST.guess.size());
+            if (!IN_REQUEST.lower_bounds.empty() || !IN_REQUEST.upper_bounds.empty()) {header.flags |= daemon_protocol::bounds;}
+
+            const int fd = this->socket_.get();
+            bool sent = aux::write_exact(fd, &header, sizeof(header)) &&
+                        aux::write_exact(fd, IN_REQUEST.parameters.data(), IN_REQUEST.parameters.size() * sizeof(double)) &&
+                        aux::write_exact(fd, IN_REQUEST.guess.data(), IN_REQUEST.guess.size() * sizeof(double));
+            if ((header.flags & daemon_protocol::bounds) != 0) {
+                sent = sent && aux::write_exact(fd, IN_REQUEST.lower_bounds.data(), header.dimension * sizeof(double)) &&
+                       aux::write_exact(fd, IN_REQUEST.upper_bounds.data(), header.dimension * sizeof(double));
+            }
+
+            solve_response response;
+            if (!sent || !aux::read_exact(fd, &response.header, sizeof(response.header)) || response.header.magic != daemon_protocol::response_magic) {
+                throw std::runtime_error("Lost connection to optimisation daemon");
+            }
+            response.point.resize(response.header.dimension);
+            if (!aux::read_exact(fd, response.point.data(), response.point.size() * sizeof(double))) {
+                throw std::runtime_error("Lost connection to optimisation daemon");
+            }
+            return response;
+        }
+
+        /**
+         * @brief Queries the daemon's queue depth and latency metrics.
+         */
+        daemon_protocol::metrics metrics () {
+            daemon_protocol::request_header header;
+            header.objective_id = daemon_protocol::metrics_objective;
+            daemon_protocol::response_header reply;
+            daemon_protocol::metrics snapshot;
+            const int fd = this->socket_.get();
+            if (!aux::write_exact(fd, &header, sizeof(header)) || !aux::read_exact(fd, &reply, sizeof(reply)) ||
+                reply.magic != daemon_protocol::metrics_magic || !aux::read_exact(fd, &snapshot, sizeof(snapshot))) {
+                throw std::runtime_error("Lost connection to optimisation daemon");
+            }
+            return snapshot;
+        }
+
+    private:
+        aux::socket_fd socket_;    ///< Connection to the daemon.
+    };
+}
+
+
+#endif //CONCEPTUAL_OPTIMISATION_DAEMON_H
@@ -0,0 +1,64 @@
+#define VERBOSITY 0
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gradient_decent.h"
+
+// Times the same multi-start batch on a work-stealing scheduler with floating workers (thread_placement::none) and
+// with workers pinned to the NUMA nodes (thread_placement::numa), and prints the fastest and the median of a few
+// repeats for both (see aux::work_stealing_scheduler). On a machine with a single node the pinning only fixes every
+// worker to one CPU, so the two timings should be close; only a multi-socket machine can show a difference.
+
+constexpr std::size_t side = 48;   // the starts form a side x side grid over the bounds
+
+double bivarient_function (const double x, const double y) noexcept {
+  constexpr double A = 10;
+  return (A * x * y) / (std::exp(x * x + y * y)) + (5.0/std::exp(1.0));
+}
+
+std::vector<std::tuple<double, double>> starts (const std::size_t side) {
+  std::vector<std::tuple<double, double>> grid;
+  for (std::size_t i = 0; i < side; ++i) {
+    for (std::size_t j = 0; j < side; ++j) {
+      grid.emplace_back(-1.8 + 3.6 * (i + 0.5) / side, -1.8 + 3.6 * (j + 0.5) / side);
+    }
+  }
+  return grid;
+}
+
+std::vector<double> batch_timings (const std::shared_ptr<aux::work_stealing_scheduler> &scheduler, const std::size_t repeats) {
+  gd::gradient_decent<double, double, double> gradient_operator(bivarient_function, 1.6, -1.2);
+  gradient_operator.add_lower_bounds(std::make_tuple(-2.0, -2.0));
+  gradient_operator.add_upper_bounds(std::make_tuple(2.0, 2.0));
+  gradient_operator.set_tolerance(1e-5);
+  gradient_operator.set_scheduler(scheduler);
+  const auto grid = starts(side);
+
+  gradient_operator.solve_multi_start(grid);   // warm-up: starts the workers and touches their memory
+  std::vector<double> timings;
+  for (std::size_t repeat = 0; repeat < repeats; ++repeat) {
+    const auto start = std::chrono::steady_clock::now();
+    gradient_operator.solve_multi_start(grid);
+    const auto end = std::chrono::steady_clock::now();
+    timings.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+  }
+  std::sort(timings.begin(), timings.end());
+  return timings;
+}
+
+int main () {
+  const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+  constexpr std::size_t repeats = 9;
+  std::printf("%zu threads, %zu starts, %zu repeats\n\n", threads, side * side, repeats);
+  std::printf("%-12s%8s%14s%14s\n", "placement", "nodes", "fastest (ms)", "median (ms)");
+  for (const auto &[name, placement] : {std::make_pair("none", aux::thread_placement::none), std::make_pair("numa", aux::thread_placement::numa)}) {
+    const auto scheduler = std::make_shared<aux::work_stealing_scheduler>(threads, placement);
+    const std::vector<double> timings = batch_timings(scheduler, repeats);
+    std::printf("%-12s%8zu%14.2f%14.2f\n", name, scheduler->node_count(), timings.front(), timings[timings.size() / 2]);
+  }
+}
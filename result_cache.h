@@ -0,0 +1,319 @@
+/**
+ * @file result_cache.h
+ * @brief Header file containing the persistent, memory-mapped result cache for the gradient descent optimiser.
+ *
+ * Identical problems (same objective, parameters, bounds, settings and initial guess) are hashed into a
+ * fingerprint. The result of a solve is stored under that fingerprint in a memory-mapped key-value file,
+ * so a later run (or another process) can return it without evaluating the objective at all. Results of
+ * the same problem family (everything except the initial guess) can also be used as warm starts.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_RESULT_CACHE_H
+#define CONCEPTUAL_RESULT_CACHE_H
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "mapped_file.h"
+
+namespace aux {
+    /**
+     * @brief Incremental 64-bit FNV-1a hash used to fingerprint problem descriptions.
+     *
+     * @code{.cpp}
+     * // example
+     * auto key = aux::fingerprint{}.add(std::string_view("bivarient")).add(1.6).add(-1.2).value();
+     * @endcode
+     */
+    struct fingerprint {
+        /**
+         * @brief Mixes raw bytes into the hash.
+         *
+         * @param IN_DATA Pointer to the bytes.
+         * @param IN_SIZE Number of bytes.
+         * @return Reference to this fingerprint for chaining.
+         */
+        fingerprint& add_bytes (const void *IN_DATA, std::size_t IN_SIZE) noexcept {
+            const auto *bytes = static_cast<const unsigned char*>(IN_DATA);
+            for (std::size_t i = 0; i < IN_SIZE; ++i) {
+                this->hash ^= bytes[i];
+                this->hash *= 1099511628211ULL;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Mixes a string (length and characters) into the hash.
+         */
+        fingerprint& add (std::string_view IN_STRING) noexcept {
+            this->add(IN_STRING.size());
+            return this->add_bytes(IN_STRING.data(), IN_STRING.size());
+        }
+
+        /**
+         * @brief Mixes a trivially copyable value into the hash.
+         */
+        template <class type>
+        requires (std::is_trivially_copyable_v<type>)
+        fingerprint& add (const type &IN_VALUE) noexcept {
+            return this->add_bytes(&IN_VALUE, sizeof(type));
+        }
+
+        /**
+         * @brief Mixes every element of a tuple into the hash.
+         */
+        template <class... types>
+        fingerprint& add (const std::tuple<types...> &IN_TUPLE) noexcept {
+            std::apply([this] (const auto&... element) {(this->add(element), ...);}, IN_TUPLE);
+            return *this;
+        }
+
+        /**
+         * @brief Returns the current hash value.
+         */
+        [[nodiscard]] std::uint64_t value () const noexcept {
+            return this->hash;
+        }
+
+    private:
+        std::uint64_t hash = 14695981039346656037ULL; ///< FNV-1a offset basis.
+    };
+}
+
+namespace gd {
+    /**
+     * @brief Persistent result cache keyed by problem fingerprint.
+     *
+     * The result_cache class stores solved problems in a memory-mapped file laid out as an open-addressing
+     * hash table with a fixed number of slots. Each slot holds the problem fingerprint, the family fingerprint
+     * (the problem without its initial guess), the initial guess, the optimal value and the optimal point.
+     *
+     * @tparam returnType The return type of the objective function.
+     * @tparam argType The types of the optimisation variables.
+     *
+     * @details
+     * Every slot is guarded by a sequence lock, so several processes may share one cache file: the sequence word is
+     * 0 while the slot is empty, odd while it is being written and even otherwise. Readers copy the slot and keep the
+     * copy only if the sequence did not change meanwhile, so an entry that is overwritten while it is read is never
+     * seen torn; a slot that is being written is treated as a miss. Probing is bounded by `max_probe` slots; when
+     * none of them is free the home slot of the key is overwritten.
+     *
+     * Inserts are not flushed to disk one by one: the mapping is shared, so other processes see them at once, and
+     * the kernel writes them back. Call sync() to schedule the write-back explicitly.
+     *
+     * @note The file layout depends on the dimension of the problem; opening a file created for a different
+     * dimension or capacity throws a runtime_error.
+     */
+    template <class returnType, class... argType>
+    class result_cache {
+    public:
+        /**
+         * @brief Number of optimisation variables stored per entry.
+         */
+        static constexpr std::size_t dimension = sizeof...(argType);
+        /**
+         * @brief Largest number of slots visited by one lookup or insert.
+         */
+        static constexpr std::size_t max_probe = 32;
+
+        /**
+         * @brief Opens (or creates) the cache file.
+         *
+         * @param IN_PATH The path of the cache file.
+         * @param IN_CAPACITY The number of slots in the file (default: 4096).
+         *
+         * @note If the process that created the file died before writing its header, the header is written again
+         * after a wait of one second (see aux::claim_initialisation()).
+         */
+        explicit result_cache (const std::string &IN_PATH, std::size_t IN_CAPACITY = 4096) :
+                file(IN_PATH, sizeof(header) + IN_CAPACITY * sizeof(entry)), capacity(IN_CAPACITY) {
+            auto *file_header = reinterpret_cast<header*>(this->file.data());
+            if (aux::claim_initialisation(file_header->magic, initialising)) {
+                file_header->version = version;
+                file_header->dimension = dimension;
+                file_header->capacity = IN_CAPACITY;
+                std::atomic_ref<std::uint64_t>(file_header->magic).store(magic, std::memory_order_release);
+            }
+            if (file_header->magic != magic || file_header->version != version || file_header->dimension != dimension || file_header->capacity != IN_CAPACITY) {
+                std::cerr << "Result cache layout mismatch in " << IN_PATH << std::endl;
+                throw std::runtime_error("Result cache layout mismatch in " + IN_PATH);
+            }
+            this->entries = reinterpret_cast<entry*>(this->file.data() + sizeof(header));
+        }
+
+        /**
+         * @brief Looks up a result by problem fingerprint.
+         *
+         * @param IN_KEY The problem fingerprint.
+         * @return The optimal value and point if the problem was solved before, std::nullopt otherwise.
+         */
+        [[nodiscard]] std::optional<std::pair<returnType, std::tuple<argType...>>> find (std::uint64_t IN_KEY) const noexcept {
+            entry copy;
+            for (std::size_t probe = 0; probe < std::min(max_probe, this->capacity); ++probe) {
+                const std::uint32_t sequence = read(this->entries[(IN_KEY + probe) % this->capacity], copy);
+                if (sequence == empty) {return std::nullopt;}
+                if (sequence != writing && copy.key == IN_KEY) {
+                    return std::make_pair(static_cast<returnType>(copy.value), to_tuple(copy.point, std::index_sequence_for<argType...>{}));
+                }
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Finds the cached optimum of the closest problem in the same family.
+         *
+         * Scans the cache for entries with the same family fingerprint and returns the optimal point of the
+         * entry whose initial guess is closest (Euclidean) to the given guess, if it lies within the radius.
+         *
+         * @param IN_FAMILY The family fingerprint (problem without initial guess).
+         * @param IN_GUESS The initial guess of the new problem.
+         * @param IN_RADIUS The largest guess distance considered a near match.
+         * @return The optimal point of the nearest match, std::nullopt if there is none.
+         */
+        [[nodiscard]] std::optional<std::tuple<argType...>> find_near (std::uint64_t IN_FAMILY, const std::tuple<argType...> &IN_GUESS, returnType IN_RADIUS) const noexcept {
+            const std::array<double, dimension> guess = to_array(IN_GUESS, std::index_sequence_for<argType...>{});
+            std::optional<std::array<double, dimension>> best;
+            double best_distance = static_cast<double>(IN_RADIUS);
+            entry copy;
+            for (std::size_t i = 0; i < this->capacity; ++i) {
+                const std::uint32_t sequence = read(this->entries[i], copy);
+                if (sequence == empty || sequence == writing || copy.family != IN_FAMILY) {continue;}
+                double sum = 0.0;
+                for (std::size_t k = 0; k < dimension; ++k) {sum += (copy.guess[k] - guess[k]) * (copy.guess[k] - guess[k]);}
+                if (std::sqrt(sum) <= best_distance) {
+                    best_distance = std::sqrt(sum);
+                    best = copy.point;
+                }
+            }
+            if (!best) {return std::nullopt;}
+            return to_tuple(*best, std::index_sequence_for<argType...>{});
+        }
+
+        /**
+         * @brief Stores a result in the cache.
+         *
+         * @param IN_KEY The problem fingerprint.
+         * @param IN_FAMILY The family fingerprint.
+         * @param IN_GUESS The initial guess of the problem.
+         * @param IN_VALUE The optimal value.
+         * @param IN_POINT The optimal point.
+         */
+        void insert (std::uint64_t IN_KEY, std::uint64_t IN_FAMILY, const std::tuple<argType...> &IN_GUESS, returnType IN_VALUE, const std::tuple<argType...> &IN_POINT) noexcept {
+            entry copy;
+            for (std::size_t probe = 0; probe < std::min(max_probe, this->capacity); ++probe) {
+                entry &slot = this->entries[(IN_KEY + probe) % this->capacity];
+                if (claim(slot, empty)) {
+                    write(slot, empty, IN_KEY, IN_FAMILY, IN_GUESS, IN_VALUE, IN_POINT);
+                    return;
+                }
+                const std::uint32_t sequence = read(slot, copy);
+                if (sequence != empty && sequence != writing && copy.key == IN_KEY) {return;}
+            }
+            entry &home = this->entries[IN_KEY % this->capacity];
+            const std::uint32_t sequence = std::atomic_ref<std::uint32_t>(home.sequence).load(std::memory_order_relaxed);
+            if (sequence % 2 == 0 && claim(home, sequence)) {
+                write(home, sequence, IN_KEY, IN_FAMILY, IN_GUESS, IN_VALUE, IN_POINT);
+            }
+        }
+
+        /**
+         * @brief Schedules the write-back of the cache file to disk.
+         */
+        void sync () const noexcept {
+            this->file.sync();
+        }
+
+    private:
+        static constexpr std::uint64_t magic = 0x6764726573756c74ULL;          ///< "gdresult"
+        static constexpr std::uint64_t initialising = 0x6764696e69746961ULL;   ///< "gdinitia"
+        static constexpr std::uint32_t version = 1;
+        static constexpr std::uint32_t empty = 0;       ///< Sequence of a slot that was never written.
+        static constexpr std::uint32_t writing = 1;     ///< Returned by read() for a slot that is being written.
+
+        struct header {
+            std::uint64_t magic;
+            std::uint32_t version;
+            std::uint32_t dimension;
+            std::uint64_t capacity;
+        };
+
+        struct entry {
+            std::uint32_t sequence;
+            std::uint32_t reserved;
+            std::uint64_t key;
+            std::uint64_t family;
+            double value;
+            std::array<double, dimension> guess;
+            std::array<double, dimension> point;
+        };
+
+        aux::mapped_file file;          ///< The backing file.
+        std::size_t capacity;           ///< Number of slots.
+        entry *entries = nullptr;       ///< First slot in the mapping.
+
+        /**
+         * @brief Copies a slot under its sequence lock.
+         *
+         * @return The (even) sequence of the consistent copy, empty for an empty slot, or writing if the slot is being
+         * written (or was changed while it was copied).
+         */
+        static std::uint32_t read (const entry &IN_SLOT, entry &OUT_COPY) noexcept {
+            const std::uint32_t sequence = std::atomic_ref<const std::uint32_t>(IN_SLOT.sequence).load(std::memory_order_acquire);
+            if (sequence == empty || sequence % 2 == 1) {return sequence == empty ? empty : writing;}
+            std::memcpy(static_cast<void*>(&OUT_COPY), &IN_SLOT, sizeof(entry));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return std::atomic_ref<const std::uint32_t>(IN_SLOT.sequence).load(std::memory_order_relaxed) == sequence ? sequence : writing;
+        }
+
+        /**
+         * @brief Locks a slot for writing if its sequence is still the expected (even) one.
+         */
+        static bool claim (entry &IN_SLOT, std::uint32_t IN_SEQUENCE) noexcept {
+            std::uint32_t sequence = IN_SEQUENCE;
+            if (!std::atomic_ref<std::uint32_t>(IN_SLOT.sequence).compare_exchange_strong(sequence, IN_SEQUENCE + 1, std::memory_order_acquire, std::memory_order_relaxed)) {return false;}
+            std::atomic_thread_fence(std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Writes a claimed slot and publishes it with the next even sequence.
+         */
+        static void write (entry &IN_SLOT, std::uint32_t IN_SEQUENCE, std::uint64_t IN_KEY, std::uint64_t IN_FAMILY, const std::tuple<argType...> &IN_GUESS, returnType IN_VALUE, const std::tuple<argType...> &IN_POINT) noexcept {
+            IN_SLOT.key = IN_KEY;
+            IN_SLOT.family = IN_FAMILY;
+            IN_SLOT.value = static_cast<double>(IN_VALUE);
+            IN_SLOT.guess = to_array(IN_GUESS, std::index_sequence_for<argType...>{});
+            IN_SLOT.point = to_array(IN_POINT, std::index_sequence_for<argType...>{});
+            // skip the empty sequence when the counter wraps around
+            std::atomic_ref<std::uint32_t>(IN_SLOT.sequence).store(IN_SEQUENCE + 2 == empty ? 2 : IN_SEQUENCE + 2, std::memory_order_release);
+        }
+
+        template <std::size_t... i>
+        static std::array<double, dimension> to_array (const std::tuple<argType...> &IN_TUPLE, std::index_sequence<i...>) noexcept {
+            return {static_cast<double>(std::get<i>(IN_TUPLE))...};
+        }
+
+        template <std::size_t... i>
+        static std::tuple<argType...> to_tuple (const std::array<double, dimension> &IN_ARRAY, std::index_sequence<i...>) noexcept {
+            return std::make_tuple(static_cast<argType>(IN_ARRAY[i])...);
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_RESULT_CACHE_H
@@ -0,0 +1,187 @@
+/**
+ * @file shared_eval_cache.h
+ * @brief Header file containing a cross-process cache of objective evaluations in shared memory.
+ *
+ * When several processes optimise the same expensive objective (multi-start, parameter studies) they evaluate
+ * overlapping points. The shared evaluation cache is a lock-free open-addressing hash table inside a shared
+ * memory-mapped file (e.g. under /dev/shm), keyed by the point quantised to a user-defined resolution, so every
+ * process on the machine reuses every evaluation made by the others.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_SHARED_EVAL_CACHE_H
+#define CONCEPTUAL_SHARED_EVAL_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "mapped_file.h"
+
+namespace gd {
+    /**
+     * @brief Lock-free, cross-process cache of objective function values.
+     *
+     * The shared_eval_cache class maps quantised points to objective values. Every coordinate is divided by the
+     * quantum and rounded to the nearest integer; points with the same quantised coordinates share one entry.
+     *
+     * @tparam returnType The return type of the objective function.
+     * @tparam argType The types of the optimisation variables.
+     *
+     * @details
+     * Slots are claimed with a compare-and-swap on their state word (empty, writing, ready) and published with a
+     * release store, so readers never see a half-written entry and no process ever blocks. Probing is bounded by
+     * `max_probe` slots: a lookup that does not find its key within the window is a miss, and an insert that finds
+     * no empty slot within the window is dropped.
+     *
+     * @note The quantum must be well below the finite difference step of the optimiser (relative step times the
+     * magnitude of the coordinates), otherwise the perturbed points of a finite difference collapse onto the
+     * point itself and the derivatives vanish.
+     *
+     * @code{.cpp}
+     * // example
+     * auto cache = std::make_shared<gd::shared_eval_cache<double, double, double>>("/dev/shm/bivarient.cache", 1 << 20, 1e-9);
+     * gradient_operator->set_eval_cache(cache);
+     * @endcode
+     */
+    template <class returnType, class... argType>
+    class shared_eval_cache {
+    public:
+        /**
+         * @brief Number of optimisation variables per key.
+         */
+        static constexpr std::size_t dimension = sizeof...(argType);
+        /**
+         * @brief Largest number of slots visited by one lookup or insert.
+         */
+        static constexpr std::size_t max_probe = 32;
+
+        /**
+         * @brief Opens (or creates) the shared cache file.
+         *
+         * @param IN_PATH The path of the cache file; use a tmpfs path such as /dev/shm/... for shared memory.
+         * @param IN_CAPACITY The number of slots.
+         * @param IN_QUANTUM The resolution points are quantised to.
+         *
+         * @note If the process that created the file died before writing its header, the header is written again
+         * after a wait of one second (see aux::claim_initialisation()).
+         */
+        shared_eval_cache (const std::string &IN_PATH, std::size_t IN_CAPACITY, double IN_QUANTUM) :
+                file(IN_PATH, sizeof(header) + IN_CAPACITY * sizeof(entry)), capacity(IN_CAPACITY), quantum(IN_QUANTUM) {
+            auto *file_header = reinterpret_cast<header*>(this->file.data());
+            if (aux::claim_initialisation(file_header->magic, initialising)) {
+                file_header->dimension = dimension;
+                file_header->capacity = IN_CAPACITY;
+                file_header->quantum = IN_QUANTUM;
+                std::atomic_ref<std::uint64_t>(file_header->magic).store(magic, std::memory_order_release);
+            }
+            if (file_header->magic != magic || file_header->dimension != dimension || file_header->capacity != IN_CAPACITY || file_header->quantum != IN_QUANTUM) {
+                std::cerr << "Shared evaluation cache layout mismatch in " << IN_PATH << std::endl;
+                throw std::runtime_error("Shared evaluation cache layout mismatch in " + IN_PATH);
+            }
+            this->entries = reinterpret_cast<entry*>(this->file.data() + sizeof(header));
+        }
+
+        /**
+         * @brief Looks up the value cached for a point.
+         *
+         * @param IN_POINT The point.
+         * @return The cached value, std::nullopt on a miss.
+         */
+        [[nodiscard]] std::optional<returnType> find (const std::tuple<argType...> &IN_POINT) const noexcept {
+            std::array<std::int64_t, dimension> key{};
+            if (!this->quantise(IN_POINT, key, std::index_sequence_for<argType...>{})) {return std::nullopt;}
+            const std::uint64_t hash = hash_key(key);
+            for (std::size_t probe = 0; probe < max_probe; ++probe) {
+                const entry &slot = this->entries[(hash + probe) % this->capacity];
+                const std::uint32_t state = std::atomic_ref<const std::uint32_t>(slot.state).load(std::memory_order_acquire);
+                if (state == empty) {return std::nullopt;}
+                if (state == ready && slot.hash == hash && slot.key == key) {return static_cast<returnType>(slot.value);}
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Stores the value of a point.
+         *
+         * @param IN_POINT The point.
+         * @param IN_VALUE The objective value at the point.
+         */
+        void insert (const std::tuple<argType...> &IN_POINT, returnType IN_VALUE) noexcept {
+            std::array<std::int64_t, dimension> key{};
+            if (!this->quantise(IN_POINT, key, std::index_sequence_for<argType...>{})) {return;}
+            const std::uint64_t hash = hash_key(key);
+            for (std::size_t probe = 0; probe < max_probe; ++probe) {
+                entry &slot = this->entries[(hash + probe) % this->capacity];
+                std::uint32_t state = empty;
+                if (std::atomic_ref<std::uint32_t>(slot.state).compare_exchange_strong(state, writing, std::memory_order_acquire)) {
+                    slot.hash = hash;
+                    slot.key = key;
+                    slot.value = static_cast<double>(IN_VALUE);
+                    std::atomic_ref<std::uint32_t>(slot.state).store(ready, std::memory_order_release);
+                    return;
+                }
+                if (state == ready && slot.hash == hash && slot.key == key) {return;}
+            }
+        }
+
+    private:
+        static constexpr std::uint64_t magic = 0x6764736861726564ULL;          ///< "gdshared"
+        static constexpr std::uint64_t initialising = 0x6764696e69746961ULL;   ///< "gdinitia"
+        static constexpr std::uint32_t empty = 0;
+        static constexpr std::uint32_t writing = 1;
+        static constexpr std::uint32_t ready = 2;
+
+        struct header {
+            std::uint64_t magic;
+            std::uint64_t dimension;
+            std::uint64_t capacity;
+            double quantum;
+        };
+
+        struct entry {
+            std::uint32_t state;
+            std::uint32_t reserved;
+            std::uint64_t hash;
+            std::array<std::int64_t, dimension> key;
+            double value;
+        };
+
+        aux::mapped_file file;      ///< The backing (shared memory) file.
+        std::size_t capacity;       ///< Number of slots.
+        double quantum;             ///< Quantisation resolution.
+        entry *entries = nullptr;   ///< First slot in the mapping.
+
+        template <std::size_t... i>
+        bool quantise (const std::tuple<argType...> &IN_POINT, std::array<std::int64_t, dimension> &OUT_KEY, std::index_sequence<i...>) const noexcept {
+            const std::array<double, dimension> scaled{(static_cast<double>(std::get<i>(IN_POINT)) / this->quantum)...};
+            for (std::size_t k = 0; k < dimension; ++k) {
+                if (!std::isfinite(scaled[k]) || std::abs(scaled[k]) > 9.0e18) {return false;}
+                OUT_KEY[k] = std::llround(scaled[k]);
+            }
+            return true;
+        }
+
+        static std::uint64_t hash_key (const std::array<std::int64_t, dimension> &IN_KEY) noexcept {
+            std::uint64_t hash = 0x9e3779b97f4a7c15ULL;
+            for (const std::int64_t each : IN_KEY) {
+                hash ^= static_cast<std::uint64_t>(each) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+                hash ^= hash >> 31;
+                hash *= 0xbf58476d1ce4e5b9ULL;
+                hash ^= hash >> 27;
+            }
+            return hash;
+        }
+    };
+}
+
+
+#endif //CONCEPTUAL_SHARED_EVAL_CACHE_H
@@ -0,0 +1,205 @@
+/**
+ * @file unix_socket.h
+ * @brief Header file containing minimal RAII helpers for stream sockets on Unix domain sockets.
+ *
+ * These helpers are shared by the optimisation daemon and the distributed multi-start coordinator.
+ * They only cover what the binary protocols of those components need: listening, connecting,
+ * reading or writing an exact number of bytes and reading whatever has arrived without blocking.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_UNIX_SOCKET_H
+#define CONCEPTUAL_UNIX_SOCKET_H
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace aux {
+    /**
+     * @brief RAII owner of a socket file descriptor.
+     *
+     * The socket_fd class closes the descriptor on destruction. It is movable but not copyable.
+     */
+    class socket_fd {
+    public:
+        socket_fd () = default;
+
+        /**
+         * @brief Takes ownership of a file descriptor.
+         */
+        explicit socket_fd (int IN_FD) noexcept : fd(IN_FD) {}
+
+        socket_fd (const socket_fd&) = delete;
+        socket_fd& operator= (const socket_fd&) = delete;
+
+        socket_fd (socket_fd &&IN_OTHER) noexcept : fd(std::exchange(IN_OTHER.fd, -1)) {}
+
+        socket_fd& operator= (socket_fd &&IN_OTHER) noexcept {
+            if (this != &IN_OTHER) {
+                this->close();
+                this->fd = std::exchange(IN_OTHER.fd, -1);
+            }
+            return *this;
+        }
+
+        ~socket_fd () {
+            this->close();
+        }
+
+        /**
+         * @brief Returns the owned descriptor (-1 if none).
+         */
+        [[nodiscard]] int get () const noexcept {
+            return this->fd;
+        }
+
+        /**
+         * @brief Returns true if a descriptor is owned.
+         */
+        [[nodiscard]] bool valid () const noexcept {
+            return this->fd >= 0;
+        }
+
+        /**
+         * @brief Shuts down both directions, waking up any thread blocked on the socket.
+         */
+        void shutdown () const noexcept {
+            if (this->fd >= 0) {::shutdown(this->fd, SHUT_RDWR);}
+        }
+
+        /**
+         * @brief Closes the descriptor.
+         */
+        void close () noexcept {
+            if (this->fd >= 0) {::close(this->fd);}
+            this->fd = -1;
+        }
+
+    private:
+        int fd = -1;    ///< The owned descriptor.
+    };
+
+    /**
+     * @brief Builds a sockaddr_un for the given path.
+     *
+     * @param IN_PATH The socket path.
+     * @return The socket address.
+     */
+    inline sockaddr_un unix_address (const std::string &IN_PATH) {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (IN_PATH.size() >= sizeof(address.sun_path)) {throw std::runtime_error("Unix socket path is too long: " + IN_PATH);}
+        std::memcpy(address.sun_path, IN_PATH.c_str(), IN_PATH.size() + 1);
+        return address;
+    }
+
+    /**
+     * @brief Creates a listening Unix domain stream socket, replacing any stale socket file.
+     *
+     * @param IN_PATH The socket path.
+     * @param IN_BACKLOG The listen backlog (default: 64).
+     * @return The listening socket.
+     */
+    inline socket_fd listen_unix (const std::string &IN_PATH, int IN_BACKLOG = 64) {
+        const sockaddr_un address = unix_address(IN_PATH);
+        socket_fd socket_(::socket(AF_UNIX, SOCK_STREAM, 0));
+        if (!socket_.valid()) {throw std::runtime_error("Cannot create Unix socket");}
+        ::unlink(IN_PATH.c_str());
+        if (::bind(socket_.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::listen(socket_.get(), IN_BACKLOG) != 0) {
+            throw std::runtime_error("Cannot listen on Unix socket " + IN_PATH + ": " + std::strerror(errno));
+        }
+        return socket_;
+    }
+
+    /**
+     * @brief Connects to a Unix domain stream socket.
+     *
+     * @param IN_PATH The socket path.
+     * @return The connected socket.
+     */
+    inline socket_fd connect_unix (const std::string &IN_PATH) {
+        const sockaddr_un address = unix_address(IN_PATH);
+        socket_fd socket_(::socket(AF_UNIX, SOCK_STREAM, 0));
+        if (!socket_.valid()) {throw std::runtime_error("Cannot create Unix socket");}
+        if (::connect(socket_.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            throw std::runtime_error("Cannot connect to Unix socket " + IN_PATH + ": " + std::strerror(errno));
+        }
+        return socket_;
+    }
+
+    /**
+     * @brief Reads exactly the requested number of bytes.
+     *
+     * @param IN_FD The socket descriptor.
+     * @param OUT_DATA The destination buffer.
+     * @param IN_SIZE The number of bytes to read.
+     * @return False if the peer closed the connection or an error occurred, true otherwise.
+     */
+    inline bool read_exact (int IN_FD, void *OUT_DATA, std::size_t IN_SIZE) noexcept {
+        auto *bytes = static_cast<char*>(OUT_DATA);
+        while (IN_SIZE > 0) {
+            const ssize_t count = ::recv(IN_FD, bytes, IN_SIZE, 0);
+            if (count < 0 && errno == EINTR) {continue;}
+            if (count <= 0) {return false;}
+            bytes += count;
+            IN_SIZE -= static_cast<std::size_t>(count);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Reads whatever has arrived without blocking and appends it to a buffer.
+     *
+     * Reads at most one chunk per call, so a connection that keeps sending cannot starve the others of a poll loop;
+     * the rest is reported readable again by the next poll.
+     *
+     * @param IN_FD The socket descriptor.
+     * @param OUT_BUFFER The buffer the received bytes are appended to.
+     * @return False if the peer closed the connection or an error occurred, true otherwise (also if nothing had arrived).
+     */
+    inline bool read_available (int IN_FD, std::vector<char> &OUT_BUFFER) {
+        char chunk[65536];
+        while (true) {
+            const ssize_t count = ::recv(IN_FD, chunk, sizeof(chunk), MSG_DONTWAIT);
+            if (count < 0 && errno == EINTR) {continue;}
+            if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {return true;}
+            if (count <= 0) {return false;}
+            OUT_BUFFER.insert(OUT_BUFFER.end(), chunk, chunk + count);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Writes exactly the requested number of bytes.
+     *
+     * @param IN_FD The socket descriptor.
+     * @param IN_DATA The source buffer.
+     * @param IN_SIZE The number of bytes to write.
+     * @return False if an error occurred, true otherwise.
+     */
+    inline bool write_exact (int IN_FD, const void *IN_DATA, std::size_t IN_SIZE) noexcept {
+        const auto *bytes = static_cast<const char*>(IN_DATA);
+        while (IN_SIZE > 0) {
+            const ssize_t count = ::send(IN_FD, bytes, IN_SIZE, MSG_NOSIGNAL);
+            if (count < 0 && errno == EINTR) {continue;}
+            if (count <= 0) {return false;}
+            bytes += count;
+            IN_SIZE -= static_cast<std::size_t>(count);
+        }
+        return true;
+    }
+}
+
+
+#endif //CONCEPTUAL_UNIX_SOCKET_H
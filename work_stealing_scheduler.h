@@ -0,0 +1,441 @@
+/**
+ * @file work_stealing_scheduler.h
+ * @brief Header file containing the work-stealing task scheduler shared by every parallel path of the optimiser.
+ *
+ * Parallel regions of the optimiser nest: a multi-start runs solves in parallel, every solve evaluates its finite
+ * difference stencil in parallel, and the daemon runs many such solves at once. A plain thread pool either
+ * oversubscribes the machine (one pool per level) or deadlocks (a pool thread blocking on tasks queued behind it).
+ * The work-stealing scheduler runs all levels on one fixed set of worker threads: every worker owns a deque, idle
+ * workers steal from the others, and a worker waiting for its children runs queued tasks instead of blocking.
+ * On multi-socket machines the workers can be pinned to the NUMA nodes, and then steal within their node first.
+ *
+ * @author Harshavardhan Karnati
+ * @date 18/10/2026
+ */
+
+#ifndef CONCEPTUAL_WORK_STEALING_SCHEDULER_H
+#define CONCEPTUAL_WORK_STEALING_SCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace aux {
+    /**
+     * @brief NUMA topology of the machine: the CPUs of every memory node.
+     *
+     * Read from /sys/devices/system/node on Linux. Elsewhere, or if the topology cannot be read, the machine is
+     * reported as a single node holding every CPU.
+     */
+    struct numa_topology {
+        std::vector<std::vector<unsigned>> nodes;   ///< CPUs of every node, in node order.
+
+        /**
+         * @brief Reads the topology of this machine.
+         */
+        static numa_topology detect () {
+            numa_topology topology;
+            const std::filesystem::path root = "/sys/devices/system/node";
+            std::error_code error;
+            std::vector<std::pair<unsigned, std::filesystem::path>> found;
+            for (const auto &entry : std::filesystem::directory_iterator(root, error)) {
+                const std::string name = entry.path().filename().string();
+                if (name.size() <= 4 || name.compare(0, 4, "node") != 0 || name.find_first_not_of("0123456789", 4) != std::string::npos) {continue;}
+                found.emplace_back(static_cast<unsigned>(std::stoul(name.substr(4))), entry.path() / "cpulist");
+            }
+            std::sort(found.begin(), found.end());
+            for (const auto &[node, path] : found) {
+                std::ifstream file(path);
+                std::string list;
+                if (!std::getline(file, list)) {continue;}
+                auto cpus = parse_cpu_list(list);
+                if (!cpus.empty()) {topology.nodes.push_back(std::move(cpus));}
+            }
+            if (topology.nodes.empty()) {
+                topology.nodes.emplace_back();
+                for (unsigned cpu = 0; cpu < std::max(1U, std::thread::hardware_concurrency()); ++cpu) {topology.nodes.back().push_back(cpu);}
+            }
+            return topology;
+        }
+
+        /**
+         * @brief Parses a kernel CPU list such as "0-3,8-11".
+         *
+         * @return The CPUs of the list; empty if it is malformed.
+         */
+        static std::vector<unsigned> parse_cpu_list (const std::string &IN_LIST) {
+            std::vector<unsigned> cpus;
+            try {
+                std::size_t begin = 0;
+                while (begin < IN_LIST.size() && IN_LIST[begin] != '\n') {
+                    const std::size_t end = std::min(IN_LIST.find(',', begin), IN_LIST.size());
+                    const std::string range = IN_LIST.substr(begin, end - begin);
+                    const std::size_t dash = range.find('-');
+                    const unsigned first = static_cast<unsigned>(std::stoul(range.substr(0, dash)));
+                    const unsigned last = dash == std::string::npos ? first : static_cast<unsigned>(std::stoul(range.substr(dash + 1)));
+                    for (unsigned cpu = first; cpu <= last; ++cpu) {cpus.push_back(cpu);}
+                    begin = end + 1;
+                }
+            } catch (std::exception &e) {
+                cpus.clear();
+            }
+            return cpus;
+        }
+    };
+
+    /**
+     * @brief Placement of the worker threads of a work_stealing_scheduler.
+     */
+    enum class thread_placement {
+        none,   ///< Workers float; the operating system places them.
+        numa    ///< Workers are pinned round-robin to the NUMA nodes (one CPU each) and steal within their node first.
+    };
+
+    /**
+     * @brief Fixed-size pool of worker threads with per-worker deques and work stealing.
+     *
+     * Tasks submitted from a worker thread go to the back of that worker's deque; the owner pops from the back
+     * (depth-first, cache-warm) and idle workers steal from the front (oldest, usually largest tasks). Tasks
+     * submitted from outside the pool go to a shared injection queue. Idle workers sleep until new work arrives.
+     *
+     * @details
+     * Fork-join parallelism is expressed with task_group. Waiting on a task_group from a worker thread runs other
+     * queued tasks (help-while-waiting), so nested parallel regions never block a worker and never need more
+     * threads than the pool has. Waiting from a thread outside the pool simply blocks; only the workers run tasks.
+     *
+     * With thread_placement::numa, every worker is pinned to one CPU, the workers are spread round-robin over the
+     * NUMA nodes, and an idle worker steals from the workers of its own node before crossing to another node. Memory
+     * first touched by a task (e.g. a workspace created inside it) is then allocated on the worker's node under the
+     * default Linux policy; current_node() lets callers keep such memory per node.
+     *
+     * @code{.cpp}
+     * // example
+     * auto scheduler = aux::work_stealing_scheduler::shared();
+     * aux::task_group group(*scheduler);
+     * for (auto &each : items) {group.run([&each] () {process(each);});}
+     * group.wait();
+     * @endcode
+     */
+    class work_stealing_scheduler {
+    public:
+        /**
+         * @brief Index returned by current_worker() on threads outside the pool.
+         */
+        static constexpr std::size_t not_a_worker = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * @brief Constructs the scheduler and starts the worker threads.
+         *
+         * @param IN_THREADS The number of worker threads (default: hardware concurrency).
+         * @param IN_PLACEMENT The placement of the worker threads (default: thread_placement::none).
+         */
+        explicit work_stealing_scheduler (std::size_t IN_THREADS = std::max(1U, std::thread::hardware_concurrency()), thread_placement IN_PLACEMENT = thread_placement::none) {
+            IN_THREADS = std::max<std::size_t>(IN_THREADS, 1);
+            this->place(IN_THREADS, IN_PLACEMENT);
+            for (std::size_t i = 0; i < IN_THREADS; ++i) {this->queues.push_back(std::make_unique<task_queue>());}
+            for (std::size_t i = 0; i < IN_THREADS; ++i) {this->threads.emplace_back([this, i] () {this->worker_loop(i);});}
+        }
+
+        work_stealing_scheduler (const work_stealing_scheduler&) = delete;
+        work_stealing_scheduler& operator= (const work_stealing_scheduler&) = delete;
+
+        /**
+         * @brief Runs the remaining tasks and joins the worker threads.
+         */
+        ~work_stealing_scheduler () {
+            {
+                std::lock_guard lock(this->sleep_mutex);
+                this->stopping = true;
+            }
+            this->wake.notify_all();
+            for (auto &thread : this->threads) {thread.join();}
+        }
+
+        /**
+         * @brief Returns the process-wide scheduler, created with hardware concurrency threads on first use.
+         */
+        static std::shared_ptr<work_stealing_scheduler> shared () {
+            static const std::shared_ptr<work_stealing_scheduler> instance = std::make_shared<work_stealing_scheduler>();
+            return instance;
+        }
+
+        /**
+         * @brief Returns the number of worker threads.
+         */
+        [[nodiscard]] std::size_t size () const noexcept {
+            return this->threads.size();
+        }
+
+        /**
+         * @brief Returns the index of the calling worker thread of this scheduler, or not_a_worker.
+         */
+        [[nodiscard]] std::size_t current_worker () const noexcept {
+            return current_owner == this ? current_index : not_a_worker;
+        }
+
+        /**
+         * @brief Returns the number of NUMA nodes the workers are spread over (1 without NUMA placement).
+         */
+        [[nodiscard]] std::size_t node_count () const noexcept {
+            return this->nodes;
+        }
+
+        /**
+         * @brief Returns the NUMA node of the calling worker thread, or 0 on threads outside the pool.
+         */
+        [[nodiscard]] std::size_t current_node () const noexcept {
+            const std::size_t index = this->current_worker();
+            return index == not_a_worker ? 0 : this->worker_nodes[index];
+        }
+
+        /**
+         * @brief Queues a task without waiting for it (fire and forget).
+         *
+         * @param IN_TASK The task. Exceptions escaping it are reported and discarded.
+         */
+        void submit (std::function<void()> IN_TASK) {
+            this->push([task = std::move(IN_TASK)] () {
+                try {task();}
+                catch (std::exception &e) {std::cerr << "Unhandled exception in scheduled task: " << e.what() << std::endl;}
+            });
+        }
+
+    private:
+        friend class task_group;
+
+        struct task_queue {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        static inline thread_local const work_stealing_scheduler *current_owner = nullptr;
+        static inline thread_local std::size_t current_index = not_a_worker;
+
+        std::vector<std::unique_ptr<task_queue>> queues;    ///< One deque per worker.
+        task_queue injection;                               ///< Tasks submitted from outside the pool.
+        std::vector<std::thread> threads;
+        std::size_t nodes = 1;                              ///< Number of NUMA nodes the workers are spread over.
+        std::vector<std::size_t> worker_nodes;              ///< NUMA node of every worker.
+        std::vector<int> worker_cpus;                       ///< CPU every worker is pinned to (-1: not pinned).
+        std::vector<std::vector<std::size_t>> victims;      ///< Steal order of every worker: own node first.
+        std::atomic<std::size_t> queued = 0;                ///< Tasks queued but not yet taken.
+        std::atomic<std::size_t> sleeping = 0;              ///< Workers waiting on `wake`.
+        std::mutex sleep_mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+
+        void push (std::function<void()> IN_TASK) {
+            const std::size_t index = this->current_worker();
+            task_queue &queue = index == not_a_worker ? this->injection : *this->queues[index];
+            {
+                std::lock_guard lock(queue.mutex);
+                queue.tasks.push_back(std::move(IN_TASK));
+            }
+            this->queued.fetch_add(1);
+            if (this->sleeping.load() > 0) {
+                {std::lock_guard lock(this->sleep_mutex);}
+                this->wake.notify_one();
+            }
+        }
+
+        /**
+         * @brief Takes a task: own deque (back), then the injection queue (front), then other deques (front).
+         *
+         * @param IN_INDEX The index of the calling worker.
+         * @param IN_INJECTED Whether tasks from the injection queue may be taken.
+         */
+        std::function<void()> take (std::size_t IN_INDEX, bool IN_INJECTED) {
+            std::function<void()> task;
+            if (this->queued.load(std::memory_order_relaxed) == 0) {return task;}
+            auto pop = [this, &task] (task_queue &IN_QUEUE, bool IN_BACK) {
+                std::lock_guard lock(IN_QUEUE.mutex);
+                if (IN_QUEUE.tasks.empty()) {return false;}
+                if (IN_BACK) {
+                    task = std::move(IN_QUEUE.tasks.back());
+                    IN_QUEUE.tasks.pop_back();
+                } else {
+                    task = std::move(IN_QUEUE.tasks.front());
+                    IN_QUEUE.tasks.pop_front();
+                }
+                this->queued.fetch_sub(1);
+                return true;
+            };
+            if (pop(*this->queues[IN_INDEX], true)) {return task;}
+            if (IN_INJECTED && pop(this->injection, false)) {return task;}
+            for (const std::size_t victim : this->victims[IN_INDEX]) {
+                if (pop(*this->queues[victim], false)) {return task;}
+            }
+            return task;
+        }
+
+        /**
+         * @brief Assigns every worker its node, CPU and steal order.
+         */
+        void place (std::size_t IN_THREADS, thread_placement IN_PLACEMENT) {
+            const numa_topology topology = IN_PLACEMENT == thread_placement::numa ? numa_topology::detect() : numa_topology{};
+            this->nodes = IN_PLACEMENT == thread_placement::numa ? topology.nodes.size() : 1;
+            for (std::size_t i = 0; i < IN_THREADS; ++i) {
+                this->worker_nodes.push_back(i % this->nodes);
+                if (IN_PLACEMENT == thread_placement::numa) {
+                    const auto &cpus = topology.nodes[i % this->nodes];
+                    this->worker_cpus.push_back(static_cast<int>(cpus[(i / this->nodes) % cpus.size()]));
+                } else {
+                    this->worker_cpus.push_back(-1);
+                }
+            }
+            this->victims.resize(IN_THREADS);
+            for (std::size_t i = 0; i < IN_THREADS; ++i) {
+                for (const bool local : {true, false}) {
+                    for (std::size_t offset = 1; offset < IN_THREADS; ++offset) {
+                        const std::size_t victim = (i + offset) % IN_THREADS;
+                        if ((this->worker_nodes[victim] == this->worker_nodes[i]) == local) {this->victims[i].push_back(victim);}
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Pins the calling worker thread to its CPU, if it has one.
+         */
+        void pin (std::size_t IN_INDEX) const noexcept {
+#if defined(__linux__)
+            if (this->worker_cpus[IN_INDEX] < 0) {return;}
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(this->worker_cpus[IN_INDEX], &set);
+            if (::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) != 0) {
+                std::cerr << "Cannot pin worker " << IN_INDEX << " to CPU " << this->worker_cpus[IN_INDEX] << std::endl;
+            }
+#endif
+        }
+
+        void worker_loop (std::size_t IN_INDEX) {
+            current_owner = this;
+            current_index = IN_INDEX;
+            this->pin(IN_INDEX);
+            while (true) {
+                if (auto task = this->take(IN_INDEX, true)) {
+                    task();
+                    continue;
+                }
+                std::unique_lock lock(this->sleep_mutex);
+                this->sleeping.fetch_add(1);
+                this->wake.wait(lock, [this] () {return this->stopping || this->queued.load() > 0;});
+                this->sleeping.fetch_sub(1);
+                if (this->stopping && this->queued.load() == 0) {return;}
+            }
+        }
+    };
+
+    /**
+     * @brief A set of tasks forked on a work_stealing_scheduler and joined with wait().
+     *
+     * The first exception thrown by a task is rethrown by wait(); the other tasks still run to completion.
+     *
+     * @note wait() must be called before the group is destroyed; the destructor waits without rethrowing.
+     */
+    class task_group {
+    public:
+        explicit task_group (work_stealing_scheduler &IN_SCHEDULER) noexcept : scheduler(IN_SCHEDULER) {}
+
+        task_group (const task_group&) = delete;
+        task_group& operator= (const task_group&) = delete;
+
+        ~task_group () {
+            this->join();
+        }
+
+        /**
+         * @brief Forks a task.
+         *
+         * @param IN_TASK The task, callable without arguments.
+         */
+        template <class funcType>
+        void run (funcType &&IN_TASK) {
+            this->outstanding.fetch_add(1, std::memory_order_relaxed);
+            this->scheduler.push([this, task = std::forward<funcType>(IN_TASK)] () mutable {
+                try {task();}
+                catch (...) {
+                    std::lock_guard lock(this->mutex);
+                    if (!this->error) {this->error = std::current_exception();}
+                }
+                std::lock_guard lock(this->mutex);
+                if (this->outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {this->done.notify_all();}
+            });
+        }
+
+        /**
+         * @brief Waits for every forked task, running other queued tasks meanwhile on worker threads.
+         *
+         * @note Rethrows the first exception thrown by a task.
+         */
+        void wait () {
+            this->join();
+            std::lock_guard lock(this->mutex);
+            if (this->error) {std::rethrow_exception(std::exchange(this->error, nullptr));}
+        }
+
+    private:
+        work_stealing_scheduler &scheduler;
+        std::atomic<std::size_t> outstanding = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done;
+
+        void join () noexcept {
+            const std::size_t index = this->scheduler.current_worker();
+            if (index == work_stealing_scheduler::not_a_worker) {
+                std::unique_lock lock(this->mutex);
+                this->done.wait(lock, [this] () {return this->outstanding.load(std::memory_order_acquire) == 0;});
+                return;
+            }
+            // Help while waiting: only tasks from the worker deques (nested work), never new top-level work
+            while (this->outstanding.load(std::memory_order_acquire) != 0) {
+                if (auto task = this->scheduler.take(index, false)) {task();}
+                else {std::this_thread::yield();}
+            }
+            // The last task still holds the mutex while it notifies
+            std::lock_guard lock(this->mutex);
+        }
+    };
+
+    /**
+     * @brief Runs `IN_FUNC(i)` for every i in [0, IN_COUNT) on the scheduler and waits for all of them.
+     *
+     * The calling thread runs the first index itself, so a single-index region costs no scheduling.
+     */
+    template <class funcType>
+    void parallel_for (work_stealing_scheduler &IN_SCHEDULER, std::size_t IN_COUNT, funcType &&IN_FUNC) {
+        if (IN_COUNT == 0) {return;}
+        task_group group(IN_SCHEDULER);
+        for (std::size_t i = 1; i < IN_COUNT; ++i) {group.run([&IN_FUNC, i] () {IN_FUNC(i);});}
+        try {IN_FUNC(std::size_t{0});}
+        catch (...) {
+            group.wait();
+            throw;
+        }
+        group.wait();
+    }
+}
+
+
+#endif //CONCEPTUAL_WORK_STEALING_SCHEDULER_H